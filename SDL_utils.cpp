@@ -14,35 +14,51 @@ void logSDLError(std::ostream& os, const std::string &msg, bool fatal)
     }
 }
 
-void initSDL(SDL_Window* &window, SDL_Renderer* &renderer, string WINDOW_TITLE, int SCREEN_WIDTH, int SCREEN_HEIGHT) 
+void initSDL(SDL_Window* &window, string WINDOW_TITLE, int SCREEN_WIDTH, int SCREEN_HEIGHT, StartupProfile* startup) 
 {
-    if (SDL_Init(SDL_INIT_EVERYTHING) != 0)
+    if (SDL_Init(SDL_INIT_VIDEO) != 0)
         logSDLError(std::cout, "SDL_Init", true);
+    if (startup != nullptr)
+        startup->mark("SDL video init");
 
     window = SDL_CreateWindow(WINDOW_TITLE.c_str(), SDL_WINDOWPOS_CENTERED,
        SDL_WINDOWPOS_CENTERED, SCREEN_WIDTH, SCREEN_HEIGHT, SDL_WINDOW_SHOWN);
     if (window == nullptr) 
         logSDLError(std::cout, "CreateWindow", true);
+    if (startup != nullptr)
+        startup->mark("window");
+}
 
-    renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | 
-                                              SDL_RENDERER_PRESENTVSYNC);
+SDL_Renderer* createRenderer(SDL_Window* window, int SCREEN_WIDTH, int SCREEN_HEIGHT, bool vsync)
+{
+    SDL_Renderer* renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | 
+                                                            (vsync ? SDL_RENDERER_PRESENTVSYNC : 0));
 
     if (renderer == nullptr) 
         logSDLError(std::cout, "CreateRenderer", true);
 
-    if (TTF_Init() == -1) {
-        logSDLError(std::cout, "TTF_Init", true);
-    }
-
     SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "linear");
     SDL_RenderSetLogicalSize(renderer, SCREEN_WIDTH, SCREEN_HEIGHT);
+    return renderer;
+}
 
+void initGameControllers()
+{
+    if (SDL_WasInit(SDL_INIT_GAMECONTROLLER) == 0 && SDL_InitSubSystem(SDL_INIT_GAMECONTROLLER) != 0) {
+        logSDLError(std::cout, "InitSubSystem");
+        return;
+    }
+    for (int i = 0; i < SDL_NumJoysticks(); i++) {
+        if (SDL_IsGameController(i) && SDL_GameControllerOpen(i) == nullptr)
+            logSDLError(std::cout, "GameControllerOpen");
+    }
 }
 
-void quitSDL(SDL_Window* window, SDL_Renderer* renderer)
+void quitSDL(SDL_Window* window)
 {
-	SDL_DestroyRenderer(renderer);
 	SDL_DestroyWindow(window);
+	// TTF chi duoc khoi tao khi can mo font (xem ResourceManager)
+	if (TTF_WasInit())
+		TTF_Quit();
 	SDL_Quit();
-    TTF_Quit();
 }
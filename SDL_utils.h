@@ -4,15 +4,25 @@
 #include <iostream>
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
+#include "startupProfile.h"
 
 using namespace std;
 
 void logSDLError(std::ostream& os,
                  const std::string &msg, bool fatal = false);
 
-void initSDL(SDL_Window* &window, SDL_Renderer* &renderer,
-             string WINDOW_TITLE, int SCREEN_WIDTH, int SCREEN_HEIGHT);
+// Chi khoi tao video (kem su kien) va tao cua so, cac he thong khac khoi tao khi dung lan dau
+void initSDL(SDL_Window* &window, string WINDOW_TITLE, int SCREEN_WIDTH, int SCREEN_HEIGHT,
+             StartupProfile* startup = nullptr);
 
-void quitSDL(SDL_Window* window, SDL_Renderer* renderer);
+// Goi tren luong se ve: moi lenh ve sau do phai chay tren chinh luong nay
+SDL_Renderer* createRenderer(SDL_Window* window, int SCREEN_WIDTH, int SCREEN_HEIGHT, bool vsync = true);
+
+// Renderer da duoc luong ve huy truoc do
+void quitSDL(SDL_Window* window);
+
+// Khoi tao he thong tay cam (neu chua) va mo tat ca tay cam dang cam,
+// tay cam cam sau se mo khi co su kien SDL_CONTROLLERDEVICEADDED
+void initGameControllers();
 
 #endif
\ No newline at end of file
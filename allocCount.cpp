@@ -0,0 +1,177 @@
+#include <stdlib.h>
+#include <string.h>
+#include <iostream>
+#include <new>
+#include <SDL2/SDL.h>
+#include "allocCount.h"
+
+using namespace std;
+
+#ifdef COUNT_ALLOCATIONS
+
+static thread_local uint64_t allocations = 0;
+static thread_local uint64_t allowedAllocations = 0;
+static thread_local int allowedDepth = 0;
+
+// Danh sach cho phep cua ALLOW_SDL_ALLOCATIONS, moi ly do kem giai thich vi sao khong tranh duoc
+// - "glyph blit": renderer phan mem tao lai blit map cua surface nguon (SDL cap phat mot nut danh sach) moi khi
+//   texture doi surface dich hay bat/tat color mod. Moi atlas chu la mot texture, ve ca vao backdrop lan man hinh,
+//   bang chu trang (tile dung cho) lan chu mau, nen vai frame co cap phat nho; nut cu duoc giai phong, bo nho khong tang
+//   Renderer phan cung khong cap phat o day
+const char* const ALLOWED_SDL_ALLOCATIONS[] = {"glyph blit"};
+
+static void countSdlAllocation() {
+    if (allowedDepth > 0)
+        allowedAllocations++;
+    else
+        allocations++;
+}
+
+void* operator new(size_t size) {
+    allocations++;
+    void* memory = malloc(size == 0 ? 1 : size);
+    if (memory == nullptr)
+        throw bad_alloc();
+    return memory;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void* operator new(size_t size, const nothrow_t&) noexcept {
+    allocations++;
+    return malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](size_t size, const nothrow_t&) noexcept {
+    return operator new(size, nothrow);
+}
+
+void operator delete(void* memory) noexcept {
+    free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+    free(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept {
+    free(memory);
+}
+
+static void* SDLCALL countedMalloc(size_t size) {
+    countSdlAllocation();
+    return malloc(size);
+}
+
+static void* SDLCALL countedCalloc(size_t count, size_t size) {
+    countSdlAllocation();
+    return calloc(count, size);
+}
+
+static void* SDLCALL countedRealloc(void* memory, size_t size) {
+    countSdlAllocation();
+    return realloc(memory, size);
+}
+
+static void SDLCALL countedFree(void* memory) {
+    free(memory);
+}
+
+bool countingAllocations() {
+    return true;
+}
+
+void installAllocationCounter() {
+    if (SDL_SetMemoryFunctions(countedMalloc, countedCalloc, countedRealloc, countedFree) != 0)
+        cout << "Unable to set SDL memory functions! Error: " << SDL_GetError() << endl;
+}
+
+uint64_t threadAllocations() {
+    return allocations;
+}
+
+uint64_t threadAllowedAllocations() {
+    return allowedAllocations;
+}
+
+AllowSdlAllocations::AllowSdlAllocations(const char* reason)
+    : mAllowed(false) {
+    for (const char* allowed : ALLOWED_SDL_ALLOCATIONS)
+        mAllowed = mAllowed || strcmp(reason, allowed) == 0;
+    if (mAllowed)
+        allowedDepth++;
+}
+
+AllowSdlAllocations::~AllowSdlAllocations() {
+    if (mAllowed)
+        allowedDepth--;
+}
+
+#else
+
+bool countingAllocations() {
+    return false;
+}
+
+void installAllocationCounter() {
+}
+
+uint64_t threadAllocations() {
+    return 0;
+}
+
+uint64_t threadAllowedAllocations() {
+    return 0;
+}
+
+#endif
+
+FrameAllocations::FrameAllocations(const char* name)
+    : mName(name), mStart(0), mAllowedStart(0), mAllowed(0), mFrames(0), mMeasured(0), mAllocatingFrames(0), mTotal(0), mMax(0),
+      mFirstAllocatingFrame(0) {
+}
+
+void FrameAllocations::beginFrame() {
+    mStart = threadAllocations();
+    mAllowedStart = threadAllowedAllocations();
+}
+
+void FrameAllocations::endFrame() {
+    const uint64_t count = threadAllocations() - mStart;
+    mFrames++;
+    if (mFrames <= ALLOCATION_WARMUP_FRAMES)
+        return;
+    mMeasured.fetch_add(1, memory_order_relaxed);
+    mAllowed += threadAllowedAllocations() - mAllowedStart;
+    if (count == 0)
+        return;
+    if (mAllocatingFrames == 0)
+        mFirstAllocatingFrame = mFrames;
+    mAllocatingFrames++;
+    mTotal += count;
+    if (count > mMax)
+        mMax = count;
+}
+
+uint64_t FrameAllocations::getMeasured() const {
+    return mMeasured.load(memory_order_relaxed);
+}
+
+uint64_t FrameAllocations::getAllocatingFrames() const {
+    return mAllocatingFrames;
+}
+
+void FrameAllocations::report() const {
+    cout << mName << ": " << getMeasured() << " frames after warmup, " << mAllocatingFrames << " allocating";
+    if (mAllocatingFrames != 0)
+        cout << " (first: frame " << mFirstAllocatingFrame << ", total " << mTotal << ", max " << mMax << " per frame)";
+    if (mAllowed != 0)
+        cout << ", " << mAllowed << " allowed SDL allocation(s)";
+    cout << endl;
+}
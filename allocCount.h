@@ -0,0 +1,61 @@
+#pragma once
+#include <stdint.h>
+#include <atomic>
+
+// Build voi -DCOUNT_ALLOCATIONS: operator new/delete va ham cap phat cua SDL (SDL_malloc, dung ca cho SDL_ttf
+// va SDL_image) dem moi lan cap phat theo tung luong. Build thuong khong dem gi, threadAllocations() luon la 0
+bool countingAllocations();
+// Phai goi truoc SDL_Init de SDL khong kip cap phat bang ham mac dinh
+void installAllocationCounter();
+// So lan cap phat cua luong goi tu luc luong bat dau
+uint64_t threadAllocations();
+// So lan cap phat cua SDL tren luong goi nam trong pham vi ALLOW_SDL_ALLOCATIONS, khong tinh vao threadAllocations
+uint64_t threadAllowedAllocations();
+
+// Danh sach cho phep: cap phat ben trong SDL ma game khong tranh duoc (xem ALLOWED_SDL_ALLOCATIONS trong allocCount.cpp)
+// Trong pham vi nay cap phat cua SDL (SDL_malloc...) duoc dem rieng va khong lam frame that bai, operator new
+// van dem nhu thuong. Ly do khong co trong danh sach thi khong duoc cho phep. Build thuong khong sinh ma nao
+class AllowSdlAllocations {
+    private:
+        bool mAllowed;
+
+    public:
+        AllowSdlAllocations(const char* reason);
+        ~AllowSdlAllocations();
+};
+
+#ifdef COUNT_ALLOCATIONS
+#define ALLOW_SDL_ALLOCATIONS(reason) AllowSdlAllocations allowSdlAllocations(reason)
+#else
+#define ALLOW_SDL_ALLOCATIONS(reason)
+#endif
+
+// So frame khoi dong bo qua: tao view, tai texture va cho font
+const uint64_t ALLOCATION_WARMUP_FRAMES = 60;
+
+class FrameAllocations {
+    // So lan cap phat moi frame cua mot luong, sau ALLOCATION_WARMUP_FRAMES frame dau moi frame phai bang 0
+    // Chi luong so huu goi beginFrame/endFrame, luong khac chi doc getMeasured trong luc chay
+    private:
+        const char* mName;
+        uint64_t mStart;
+        uint64_t mAllowedStart;
+        uint64_t mAllowed;
+        uint64_t mFrames;
+        std::atomic<uint64_t> mMeasured;
+        uint64_t mAllocatingFrames;
+        uint64_t mTotal;
+        uint64_t mMax;
+        // Frame (tinh tu dau) dau tien co cap phat sau khi khoi dong
+        uint64_t mFirstAllocatingFrame;
+
+    public:
+        FrameAllocations(const char* name);
+
+        void beginFrame();
+        void endFrame();
+        // So frame da do sau khi khoi dong
+        uint64_t getMeasured() const;
+        uint64_t getAllocatingFrames() const;
+        void report() const;
+};
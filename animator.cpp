@@ -0,0 +1,71 @@
+#include "animator.h"
+#include "layout.h"
+
+using namespace std;
+
+SlideAnimator::SlideAnimator() {
+    mStartTime = 0;
+    mDuration = 0;
+    mRunning = false;
+    // Mot lan truot day nhieu nhat MAX_DIFFICULTY - 1 tile, du cho truoc de them tile khong cap phat
+    mTiles.reserve(MAX_DIFFICULTY - 1);
+    mFrom.reserve(MAX_DIFFICULTY - 1);
+    mTo.reserve(MAX_DIFFICULTY - 1);
+}
+
+void SlideAnimator::clear() {
+    mTiles.clear();
+    mFrom.clear();
+    mTo.clear();
+    mRunning = false;
+}
+
+void SlideAnimator::add(Tile* const tile, const int toX, const int toY) {
+    mTiles.push_back(tile);
+    mFrom.push_back({tile->getXPosition(), tile->getYPosition()});
+    mTo.push_back({toX, toY});
+}
+
+void SlideAnimator::start(const Uint32 now, const Uint32 duration) {
+    mStartTime = now;
+    mDuration = duration;
+    mRunning = true;
+}
+
+bool SlideAnimator::update(const Uint32 now) {
+    if (!mRunning)
+        return true;
+
+    const Uint32 elapsed = now - mStartTime;
+    const bool done = (elapsed >= mDuration);
+    const float progress = done ? 1.0f : (float)elapsed / mDuration;
+
+    for (size_t i = 0; i < mTiles.size(); i++) {
+        const int x = mFrom[i].x + (int)((mTo[i].x - mFrom[i].x) * progress);
+        const int y = mFrom[i].y + (int)((mTo[i].y - mFrom[i].y) * progress);
+        mTiles[i]->setPositionTo(x, y);
+    }
+
+    if (done)
+        mRunning = false;
+    return done;
+}
+
+bool SlideAnimator::isRunning() const {
+    return mRunning;
+}
+
+bool SlideAnimator::getMotion(const Tile* const tile, SDL_Point& from, SDL_Point& to, Uint32& start, Uint32& duration) const {
+    if (!mRunning)
+        return false;
+    for (size_t i = 0; i < mTiles.size(); i++) {
+        if (mTiles[i] == tile) {
+            from = mFrom[i];
+            to = mTo[i];
+            start = mStartTime;
+            duration = mDuration;
+            return true;
+        }
+    }
+    return false;
+}
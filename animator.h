@@ -0,0 +1,28 @@
+#pragma once
+#include <vector>
+#include <SDL2/SDL.h>
+#include "tile.h"
+
+class SlideAnimator {
+    // Truot cac tile tu vi tri hien tai den vi tri dich trong mot khoang thoi gian co dinh
+    // Vi tri tinh theo thoi gian da troi qua nen toc do khong phu thuoc vao FPS
+    private:
+        std::vector<Tile*> mTiles;
+        std::vector<SDL_Point> mFrom;
+        std::vector<SDL_Point> mTo;
+        Uint32 mStartTime;
+        Uint32 mDuration;
+        bool mRunning;
+
+    public:
+        SlideAnimator();
+
+        void clear();
+        void add(Tile* const tile, const int toX, const int toY);
+        void start(const Uint32 now, const Uint32 duration);
+        // Tra ve true khi tat ca tile da den dich
+        bool update(const Uint32 now);
+        bool isRunning() const;
+        // Chuyen dong cua tile trong animation dang chay, false neu tile khong truot
+        bool getMotion(const Tile* const tile, SDL_Point& from, SDL_Point& to, Uint32& start, Uint32& duration) const;
+};
@@ -0,0 +1,76 @@
+#include <algorithm>
+#include <chrono>
+#include "autoSolve.h"
+#include "solver.h"
+#include "optimizer.h"
+#include "trace.h"
+
+using namespace std;
+
+AutoSolver::AutoSolver(MoveQueue& queue)
+    : mCancel(false), mQueue(queue) {
+}
+
+AutoSolver::~AutoSolver() {
+    stop();
+}
+
+void AutoSolver::start(const Board& board, const vector<Move>& history) {
+    stop();
+    mQueue.clear();
+    mCancel = false;
+    mThread = thread(&AutoSolver::run, this, board, history);
+}
+
+void AutoSolver::stop() {
+    mCancel = true;
+    if (mThread.joinable())
+        mThread.join();
+}
+
+bool AutoSolver::push(const Move move) {
+    while (!mQueue.push({move, 1})) {
+        if (mCancel)
+            return false;
+        this_thread::sleep_for(chrono::milliseconds(AUTO_SOLVE_WAIT_MS));
+    }
+    return true;
+}
+
+void AutoSolver::run(Board board, vector<Move> history) {
+    traceThreadName("auto solver");
+    TRACE_SCOPE("auto solve");
+    const bool optimal = board.getSize() <= 4;
+    if (optimal && pushOptimal(board, AUTO_SOLVE_FIRST_BUDGET))
+        return;
+
+    // Loi giai dao nguoc tu lich su: bo cac doan thua tren ca chuoi (tuyen tinh, rat nhanh)
+    // roi toi uu tung doan nho va day ngay vao hang doi, tile dau tien chay trong khi phan sau con dang toi uu
+    const vector<Move> path = removeCycles(board, cancelInverseMoves(invertMoves(history)));
+    for (size_t begin = 0; begin < path.size() && !mCancel; begin += AUTO_SOLVE_CHUNK) {
+        const size_t end = min(path.size(), begin + AUTO_SOLVE_CHUNK);
+        const vector<Move> chunk(path.begin() + begin, path.begin() + end);
+        for (const Move move : optimizeSolution(board, chunk)) {
+            board.applyMove(move);
+            if (!push(move))
+                return;
+        }
+        // Doan nay chay trong luc tim loi giai toi uu cho phan con lai, tim duoc thi thay het phan sau
+        if (optimal && end < path.size() && pushOptimal(board, AUTO_SOLVE_NODE_BUDGET))
+            return;
+    }
+}
+
+bool AutoSolver::pushOptimal(const Board& board, const unsigned long long nodeBudget) {
+    // true khi khong can lam gi them: da day loi giai toi uu hoac bi dung
+    const SolveResult result = solveOptimal(board, nodeBudget, &mCancel);
+    if (result.status == SOLVE_CANCELLED)
+        return true;
+    if (result.status != SOLVE_FOUND)
+        return false;
+    for (const Move move : result.moves) {
+        if (!push(move))
+            return true;
+    }
+    return true;
+}
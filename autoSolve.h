@@ -0,0 +1,40 @@
+#pragma once
+#include <thread>
+#include <atomic>
+#include <vector>
+#include "board.h"
+#include "moveQueue.h"
+
+// Loi giai toi uu (3x3, 4x4) thu ngay voi it nut, khoang mot frame o ~80 ns/nut, de tile dau tien chay gan nhu tuc thi
+const unsigned long long AUTO_SOLVE_FIRST_BUDGET = 200000ULL;
+// Khong du thi chay loi giai rut gon, va trong luc cac doan da day dang chay thu lai voi nhieu nut hon
+// tu trang thai cuoi hang doi
+const unsigned long long AUTO_SOLVE_NODE_BUDGET = 50000000ULL;
+// So nuoc di cua lich su duoc toi uu moi lan truoc khi day vao hang doi
+const size_t AUTO_SOLVE_CHUNK = 128;
+// Suc chua hang doi loi giai, day thi luong giai cho vong lap game lay bot (moi lan AUTO_SOLVE_WAIT_MS)
+const size_t AUTO_SOLVE_QUEUE_CAPACITY = 256;
+const unsigned int AUTO_SOLVE_WAIT_MS = 5;
+
+class AutoSolver {
+    // Tao loi giai tren luong rieng va day dan vao hang doi de animation chay song song
+    // Nuoc dau tien luon co sau it nhat mot frame tinh toan, phan sau duoc lam tot dan trong luc tile dang chay
+    private:
+        std::thread mThread;
+        std::atomic<bool> mCancel;
+        MoveQueue& mQueue;
+
+        void run(Board board, std::vector<Move> history);
+        // Tra ve false khi bi dung trong luc cho hang doi con cho
+        bool push(const Move move);
+        // Tim loi giai toi uu tu board trong nodeBudget nut va day vao hang doi
+        // false khi khong tim duoc trong ngan ay nut (chua day gi), true khi da day xong hoac bi dung
+        bool pushOptimal(const Board& board, const unsigned long long nodeBudget);
+
+    public:
+        AutoSolver(MoveQueue& queue);
+        ~AutoSolver();
+
+        void start(const Board& board, const std::vector<Move>& history);
+        void stop();
+};
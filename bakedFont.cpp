@@ -0,0 +1,104 @@
+#include <iostream>
+#include <vector>
+#include "bakedFont.h"
+#include "resources.h"
+
+#if defined(__has_include)
+#if __has_include("fontAtlasData.h")
+#include "fontAtlasData.h"
+#define HAS_BAKED_FONT 1
+#endif
+#endif
+
+using namespace std;
+
+BakedFont::BakedFont()
+    : mTexture(nullptr) {
+}
+
+BakedFont::~BakedFont() {
+    free();
+}
+
+bool BakedFont::isAvailable() {
+#ifdef HAS_BAKED_FONT
+    return true;
+#else
+    return false;
+#endif
+}
+
+uint32_t BakedFont::checksum() {
+#ifdef HAS_BAKED_FONT
+    // FNV-1a tren atlas da nen va bang vi tri ky tu
+    uint32_t hash = 2166136261u;
+    for (const unsigned char byte : BAKED_ATLAS_RLE) {
+        hash ^= byte;
+        hash *= 16777619u;
+    }
+    for (const BakedGlyph& glyph : BAKED_GLYPHS) {
+        for (const int value : {glyph.size, glyph.character, glyph.x, glyph.y, glyph.w, glyph.h}) {
+            hash ^= (uint32_t)value;
+            hash *= 16777619u;
+        }
+    }
+    return hash;
+#else
+    return 0;
+#endif
+}
+
+bool BakedFont::load(SDL_Renderer* const renderer) {
+#ifdef HAS_BAKED_FONT
+    free();
+
+    // Giai nen kenh alpha roi tao mot surface chu trang, mau chu dat bang ColorMod luc ve
+    vector<unsigned char> alpha(BAKED_ATLAS_WIDTH * BAKED_ATLAS_HEIGHT);
+    if (!bakedRleDecode(BAKED_ATLAS_RLE, sizeof(BAKED_ATLAS_RLE), alpha.data(), alpha.size())) {
+        cout << "Baked font atlas is corrupted!" << endl;
+        return false;
+    }
+    SDL_Surface* atlas = SDL_CreateRGBSurfaceWithFormat(0, BAKED_ATLAS_WIDTH, BAKED_ATLAS_HEIGHT, 32, SDL_PIXELFORMAT_RGBA32);
+    if (atlas == nullptr) {
+        cout << "Unable to create baked font surface! Error: " << SDL_GetError() << endl;
+        return false;
+    }
+    for (int y = 0; y < BAKED_ATLAS_HEIGHT; y++) {
+        Uint8* row = (Uint8*)atlas->pixels + y * atlas->pitch;
+        for (int x = 0; x < BAKED_ATLAS_WIDTH; x++) {
+            row[4 * x] = row[4 * x + 1] = row[4 * x + 2] = 255;
+            row[4 * x + 3] = alpha[y * BAKED_ATLAS_WIDTH + x];
+        }
+    }
+    mTexture = TRACK_TEXTURE(SDL_CreateTextureFromSurface(renderer, atlas));
+    SDL_FreeSurface(atlas);
+    if (mTexture == nullptr) {
+        cout << "Unable to create texture from baked font! Error: " << SDL_GetError() << endl;
+        return false;
+    }
+    SDL_SetTextureBlendMode(mTexture, SDL_BLENDMODE_BLEND);
+
+    for (const BakedGlyph& glyph : BAKED_GLYPHS) {
+        if (mAtlases.count(glyph.size) == 0)
+            mAtlases[glyph.size].share(mTexture);
+        mAtlases[glyph.size].setGlyph((char)glyph.character, {glyph.x, glyph.y, glyph.w, glyph.h});
+    }
+    return true;
+#else
+    (void)renderer;
+    return false;
+#endif
+}
+
+const GlyphAtlas* BakedFont::getAtlas(const int size) const {
+    auto found = mAtlases.find(size);
+    return (found == mAtlases.end()) ? nullptr : &found->second;
+}
+
+void BakedFont::free() {
+    for (auto& atlas : mAtlases)
+        atlas.second.free();
+    mAtlases.clear();
+    destroyTexture(mTexture);
+    mTexture = nullptr;
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include <map>
+#include <stdint.h>
+#include <SDL2/SDL.h>
+#include "glyphAtlas.h"
+
+// Mot ky tu da ve san: co chu, ky tu va vung cua no trong atlas
+struct BakedGlyph {
+    int size;
+    int character;
+    int x, y, w, h;
+};
+
+class BakedFont {
+    // Font da duoc fontBaker ve san luc build va nhung vao file chay (fontAtlasData.h) duoi dang mang nen RLE
+    // Giai nen thanh mot texture duy nhat, moi co chu la mot GlyphAtlas dung chung texture nay
+    // Khong co fontAtlasData.h thi isAvailable() tra ve false va game dung SDL_ttf nhu cu
+    private:
+        SDL_Texture* mTexture;
+        std::map<int, GlyphAtlas> mAtlases;
+
+    public:
+        BakedFont();
+        ~BakedFont();
+
+        static bool isAvailable();
+        // Checksum cua du lieu da ve san, doi khi layout hay ban FreeType cua fontBaker doi; 0 neu khong co
+        static uint32_t checksum();
+        bool load(SDL_Renderer* const renderer);
+        // nullptr neu co chu nay khong duoc ve san
+        const GlyphAtlas* getAtlas(const int size) const;
+        void free();
+};
+
+// Nen/giai nen alpha cua atlas: tung cap (so lan lap 1..255, gia tri)
+// Dung chung cho fontBaker va luc chay
+inline size_t bakedRleEncode(const unsigned char* data, const size_t length, unsigned char* output) {
+    size_t written = 0;
+    for (size_t i = 0; i < length; ) {
+        size_t run = 1;
+        while (i + run < length && run < 255 && data[i + run] == data[i])
+            run++;
+        if (output != nullptr) {
+            output[written] = (unsigned char)run;
+            output[written + 1] = data[i];
+        }
+        written += 2;
+        i += run;
+    }
+    return written;
+}
+
+inline bool bakedRleDecode(const unsigned char* data, const size_t length, unsigned char* output, const size_t outputLength) {
+    size_t written = 0;
+    for (size_t i = 0; i + 1 < length; i += 2) {
+        if (written + data[i] > outputLength)
+            return false;
+        for (int run = 0; run < data[i]; run++)
+            output[written++] = data[i + 1];
+    }
+    return written == outputLength;
+}
@@ -0,0 +1,374 @@
+// Benchmark cua loi game va duong ve: moi benchmark chay nhieu lan, in mean/stddev/min va ghi ra JSON
+// Tham so: [--runs N] [--out file.json] [--filter chuoi] [--compare baseline.json] [--threshold phan tram]
+//          [--allow-missing]
+// So sanh chi co nghia voi baseline ghi tren cung may: ghi lai bang make benchbaseline tren may se chay
+// make benchcheck, luc may ranh, roi commit benchBaseline.json. Nguong phai lon hon do dao dong giua hai lan chay
+// tren may do (chay bench --compare voi chinh baseline vua ghi de xem)
+#include <math.h>
+#include <stdlib.h>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <string>
+#include "frontend.cpp"
+
+using namespace std;
+
+const string BENCH_FILE = "bench.json";
+const int DEFAULT_RUNS = 10;
+// Che do so sanh: cham hon baseline qua nguong nay (phan tram, so theo min) thi tinh la thut lui
+// Tren may ao mot nhan dung chung, min cua 30 lan chay lech nhau toi khoang 45% giua hai lan chay bench
+const double DEFAULT_THRESHOLD = 50;
+
+// So thao tac trong moi lan chay, du de moi lan chay mat vai ms tro len
+const int SHUFFLES_PER_RUN = 200;
+const unsigned int MOVES_PER_RUN = 1000000;
+const int SOLVED_CHECKS_PER_RUN = 1000000;
+const int HIT_TESTS_PER_RUN = 1000000;
+const int ESTIMATES_PER_RUN = 200000;
+const int FRAMES_PER_RUN = 50;
+
+// Diem bam va bang dung chung cho moi lan chay, sinh tu seed co dinh
+const int HIT_POINTS = 1024;
+const int ESTIMATE_BOARDS = 64;
+const unsigned int BENCH_SEED = 12345;
+
+// Bo bang cho solver: dao ngau nhien hoan toan tu bang da xep bang seed co dinh, khong phai bo de chuan nao
+// Voi BENCH_SEED, 5 bang 4x4 can tong cong khoang 2.3 trieu nut (loi giai 48-54 nuoc), du de do toc do tim kiem
+const int SOLVER_INSTANCES = 5;
+const unsigned int SOLVER_SHUFFLE_3 = 1000;
+const unsigned int SOLVER_SHUFFLE_4 = 1000;
+const unsigned long long SOLVER_NODE_BUDGET = 100000000ULL;
+
+struct BenchOptions {
+    int runs;
+    string output;
+    string filter;
+    string baseline;
+    double threshold;
+    // Cho phep benchmark khong co trong baseline (benchmark moi them), mac dinh tinh la that bai
+    bool allowMissing;
+};
+
+// Ket qua cua mot benchmark doc lai tu file JSON
+struct BenchStats {
+    double mean;
+    double min;
+};
+
+struct BenchResult {
+    string name;
+    string unit;
+    // Moi lan chay mot gia tri (theo don vi unit)
+    vector<double> samples;
+};
+
+// Ket qua tinh toan duoc cong vao day de trinh bien dich khong bo vong lap
+static volatile long long benchSink = 0;
+
+static double seconds() {
+    return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static double mean(const vector<double>& samples) {
+    double sum = 0;
+    for (double sample : samples)
+        sum += sample;
+    return sum / samples.size();
+}
+
+static double stddev(const vector<double>& samples) {
+    if (samples.size() < 2)
+        return 0;
+    const double average = mean(samples);
+    double sum = 0;
+    for (double sample : samples)
+        sum += (sample - average) * (sample - average);
+    return sqrt(sum / (samples.size() - 1));
+}
+
+static double minimum(const vector<double>& samples) {
+    double best = samples[0];
+    for (double sample : samples)
+        best = min(best, sample);
+    return best;
+}
+
+static string boardName(const char* prefix, const int size) {
+    return string(prefix) + "/" + to_string(size) + "x" + to_string(size);
+}
+
+template <typename Run>
+static void benchmark(vector<BenchResult>& results, const BenchOptions& options, const string& name, const string& unit, Run run) {
+    if (!options.filter.empty() && name.find(options.filter) == string::npos)
+        return;
+    BenchResult result = {name, unit, vector<double>()};
+    // Lan chay dau de lam nong cache va bo cap phat, khong tinh
+    run();
+    for (int i = 0; i < options.runs; i++)
+        result.samples.push_back(run());
+    cout << left << setw(28) << name << right << fixed << setprecision(3) << setw(12) << mean(result.samples)
+         << " +- " << setw(9) << stddev(result.samples) << "  min " << setw(12) << minimum(result.samples)
+         << "  " << unit << endl;
+    results.push_back(result);
+}
+
+static void coreBenchmarks(vector<BenchResult>& results, const BenchOptions& options) {
+    for (unsigned int size = MIN_DIFFICULTY; size <= MAX_DIFFICULTY; size++) {
+        benchmark(results, options, boardName("shuffle", size), "us/shuffle", [&]() {
+            Random random(BENCH_SEED);
+            const double start = seconds();
+            for (int i = 0; i < SHUFFLES_PER_RUN; i++) {
+                Board board(size);
+                benchSink += board.shuffle(TOTAL_SWAPS, random).size();
+            }
+            return (seconds() - start) * 1e6 / SHUFFLES_PER_RUN;
+        });
+    }
+
+    for (unsigned int size = MIN_DIFFICULTY; size <= MAX_DIFFICULTY; size++) {
+        // Chuoi nuoc hop le lay tu mot lan dao, ap dung lai tu bang da xep
+        Random random(BENCH_SEED);
+        Board shuffled(size);
+        const vector<Move> moves = shuffled.shuffle(MOVES_PER_RUN, random);
+        benchmark(results, options, boardName("moves", size), "ns/move", [&]() {
+            Board board(size);
+            const double start = seconds();
+            for (const Move move : moves)
+                board.applyMove(move);
+            const double elapsed = seconds() - start;
+            benchSink += board.getHash();
+            return elapsed * 1e9 / moves.size();
+        });
+    }
+
+    for (unsigned int size = MIN_DIFFICULTY; size <= MAX_DIFFICULTY; size++) {
+        // Bang da xep la truong hop xau nhat: phai xem het moi o
+        const Board board(size);
+        benchmark(results, options, boardName("solvedCheck", size), "ns/check", [&]() {
+            const double start = seconds();
+            for (int i = 0; i < SOLVED_CHECKS_PER_RUN; i++)
+                benchSink += board.isSolved();
+            return (seconds() - start) * 1e9 / SOLVED_CHECKS_PER_RUN;
+        });
+    }
+
+    preparePatternDatabase();
+    for (unsigned int size = MIN_DIFFICULTY; size <= MAX_DIFFICULTY; size++) {
+        Random random(BENCH_SEED);
+        vector<Board> boards;
+        boards.reserve(ESTIMATE_BOARDS);
+        for (int i = 0; i < ESTIMATE_BOARDS; i++) {
+            boards.emplace_back(size);
+            boards.back().shuffle(TOTAL_SWAPS, random);
+        }
+        benchmark(results, options, boardName("heuristic", size), "ns/eval", [&]() {
+            const double start = seconds();
+            for (int i = 0; i < ESTIMATES_PER_RUN; i++)
+                benchSink += estimateDistance(boards[i % ESTIMATE_BOARDS]);
+            return (seconds() - start) * 1e9 / ESTIMATES_PER_RUN;
+        });
+    }
+
+    for (unsigned int size = 3; size <= 4; size++) {
+        Random random(BENCH_SEED);
+        vector<Board> instances;
+        for (int i = 0; i < SOLVER_INSTANCES; i++) {
+            instances.emplace_back(size);
+            instances.back().shuffle(size == 3 ? SOLVER_SHUFFLE_3 : SOLVER_SHUFFLE_4, random);
+        }
+        benchmark(results, options, boardName("solver", size), "ns/node", [&]() {
+            unsigned long long nodes = 0;
+            const double start = seconds();
+            for (const Board& instance : instances) {
+                const SolveResult result = solveOptimal(instance, SOLVER_NODE_BUDGET);
+                nodes += result.nodes;
+                benchSink += result.moves.size();
+            }
+            // Bang da xep san khong can mo nut nao, khong co gi de chia
+            return (nodes == 0) ? 0 : (seconds() - start) * 1e9 / nodes;
+        });
+    }
+}
+
+static void sceneBenchmarks(vector<BenchResult>& results, const BenchOptions& options) {
+    // Bang choi that tren mot renderer phan mem ve vao surface, khong can cua so hay the do hoa
+    SDL_Surface* surface = SDL_CreateRGBSurfaceWithFormat(0, SCREEN_WIDTH, SCREEN_HEIGHT, 32, SDL_PIXELFORMAT_RGBA8888);
+    if (surface == nullptr) {
+        cout << "Unable to create render surface! Error: " << SDL_GetError() << endl;
+        return;
+    }
+    SDL_Renderer* renderer = SDL_CreateSoftwareRenderer(surface);
+    if (renderer == nullptr) {
+        cout << "Unable to create software renderer! Error: " << SDL_GetError() << endl;
+        SDL_FreeSurface(surface);
+        return;
+    }
+
+    ResourceManager resources;
+    resources.loadBakedFont(renderer);
+    PictureLoader picture;
+    TelemetryWriter telemetry("");
+    FrameStats frameStats;
+    unique_ptr<FrameSnapshot> snapshot(new FrameSnapshot());
+
+    for (unsigned int size = MIN_DIFFICULTY; size <= MAX_DIFFICULTY; size++) {
+        Random random(BENCH_SEED);
+        PuzzleScene scene(picture, telemetry, frameStats, size, SCREEN_WIDTH, SCREEN_HEIGHT);
+        scene.newGame(TILE_MODE_NUMBERS, BENCH_SEED);
+
+        // Diem bam rai khap man hinh, ca tren vien va ngoai bang
+        int points[HIT_POINTS][2];
+        for (int i = 0; i < HIT_POINTS; i++) {
+            points[i][0] = random.below(SCREEN_WIDTH);
+            points[i][1] = random.below(SCREEN_HEIGHT);
+        }
+        benchmark(results, options, boardName("hitTest", size), "ns/test", [&]() {
+            int row, col;
+            const double start = seconds();
+            for (int i = 0; i < HIT_TESTS_PER_RUN; i++) {
+                const int* point = points[i % HIT_POINTS];
+                benchSink += scene.cellAt(point[0], point[1], row, col);
+            }
+            return (seconds() - start) * 1e9 / HIT_TESTS_PER_RUN;
+        });
+
+        scene.publish(*snapshot);
+        PuzzleView view(renderer, resources, picture, *snapshot, SCREEN_WIDTH, SCREEN_HEIGHT);
+        // Frame binh thuong: copy backdrop, ve dong ho; va frame phai ve lai backdrop (tile vua dung lai)
+        // Dong ho cao bang mot hang tile nen bang nho ve nhieu pixel hon moi frame (render/3x3 cham hon 6x6)
+        for (const bool redraw : {false, true}) {
+            benchmark(results, options, boardName("render", size) + (redraw ? "/backdrop" : ""), "us/frame", [&]() {
+                const double start = seconds();
+                for (int i = 0; i < FRAMES_PER_RUN; i++) {
+                    if (redraw)
+                        snapshot->staticVersion++;
+                    view.apply(*snapshot, 0);
+                    view.render();
+                    SDL_RenderPresent(renderer);
+                }
+                return (seconds() - start) * 1e6 / FRAMES_PER_RUN;
+            });
+        }
+    }
+
+    picture.free();
+    resources.free();
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(surface);
+}
+
+static bool writeResults(const string& path, const vector<BenchResult>& results, const int runs) {
+    // Moi benchmark mot dong de de doc lai va so sanh
+    ofstream output(path);
+    if (!output) {
+        cout << "Unable to write " << path << endl;
+        return false;
+    }
+    output << "{\"runs\":" << runs << ",\"benchmarks\":[\n";
+    output << setprecision(6);
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult& result = results[i];
+        output << "{\"name\":\"" << result.name << "\",\"unit\":\"" << result.unit << "\",\"mean\":"
+               << mean(result.samples) << ",\"stddev\":" << stddev(result.samples) << ",\"min\":"
+               << minimum(result.samples) << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    output << "]}\n";
+    return true;
+}
+
+static double jsonNumber(const string& line, const string& key) {
+    const size_t found = line.find("\"" + key + "\":");
+    return (found == string::npos) ? -1 : atof(line.c_str() + found + key.size() + 3);
+}
+
+static bool readResults(const string& path, map<string, BenchStats>& stats) {
+    // Chi doc dung dinh dang writeResults ghi ra: moi dong mot benchmark
+    ifstream input(path);
+    if (!input) {
+        cout << "Unable to read " << path << endl;
+        return false;
+    }
+    const string NAME_KEY = "\"name\":\"";
+    string line;
+    while (getline(input, line)) {
+        const size_t begin = line.find(NAME_KEY);
+        if (begin == string::npos)
+            continue;
+        const size_t end = line.find('"', begin + NAME_KEY.size());
+        const string name = line.substr(begin + NAME_KEY.size(), end - begin - NAME_KEY.size());
+        stats[name] = {jsonNumber(line, "mean"), jsonNumber(line, "min")};
+    }
+    return true;
+}
+
+static int compareResults(const vector<BenchResult>& results, const map<string, BenchStats>& baseline,
+                          const BenchOptions& options) {
+    // Moi so deu la thoi gian cho mot thao tac nen lon hon la cham hon; so min vi it nhieu hon mean
+    // Benchmark khong co trong baseline cung tinh la that bai, tru khi co --allow-missing
+    const double threshold = options.threshold;
+    int regressions = 0;
+    int missing = 0;
+    cout << endl << "Compared with baseline (threshold " << threshold << "%):" << endl;
+    for (const BenchResult& result : results) {
+        cout << left << setw(28) << result.name << right;
+        const auto found = baseline.find(result.name);
+        if (found == baseline.end() || found->second.min <= 0) {
+            cout << (options.allowMissing ? "  no baseline" : "  NO BASELINE") << endl;
+            missing++;
+            continue;
+        }
+        const double change = (minimum(result.samples) / found->second.min - 1) * 100;
+        cout << fixed << setprecision(3) << setw(12) << found->second.min << " -> " << setw(12)
+             << minimum(result.samples) << "  " << showpos << setprecision(1) << setw(7) << change << "%"
+             << noshowpos;
+        if (change > threshold) {
+            cout << "  REGRESSED";
+            regressions++;
+        }
+        cout << endl;
+    }
+    cout << regressions << " regression(s), " << missing << " without baseline" << endl;
+    return options.allowMissing ? regressions : regressions + missing;
+}
+
+int main(int argc, char* args[]) {
+    BenchOptions options = {DEFAULT_RUNS, BENCH_FILE, "", "", DEFAULT_THRESHOLD, false};
+    for (int i = 1; i < argc; i++) {
+        const string arg = args[i];
+        if (arg == "--runs" && i + 1 < argc)
+            options.runs = max(1, atoi(args[++i]));
+        else if (arg == "--out" && i + 1 < argc)
+            options.output = args[++i];
+        else if (arg == "--filter" && i + 1 < argc)
+            options.filter = args[++i];
+        else if (arg == "--compare" && i + 1 < argc)
+            options.baseline = args[++i];
+        else if (arg == "--threshold" && i + 1 < argc)
+            options.threshold = atof(args[++i]);
+        else if (arg == "--allow-missing")
+            options.allowMissing = true;
+        else {
+            cout << "Usage: bench [--runs N] [--out file.json] [--filter name] [--compare baseline.json] [--threshold percent]"
+                    " [--allow-missing]" << endl;
+            return 1;
+        }
+    }
+    // Doc baseline truoc khi chay de file sai khong lam mat ca lan chay
+    map<string, BenchStats> baseline;
+    if (!options.baseline.empty() && !readResults(options.baseline, baseline))
+        return 1;
+
+    vector<BenchResult> results;
+    coreBenchmarks(results, options);
+    sceneBenchmarks(results, options);
+    const bool written = writeResults(options.output, results, options.runs);
+    const int regressions = options.baseline.empty() ? 0 : compareResults(results, baseline, options);
+
+    if (TTF_WasInit())
+        TTF_Quit();
+    SDL_Quit();
+    return (written && regressions == 0) ? 0 : 1;
+}
@@ -0,0 +1,197 @@
+#include <stdlib.h>
+#include "board.h"
+
+using namespace std;
+
+Board::Board(const int size) {
+    mSize = size;
+    mCells.resize(size * size);
+    for (int i = 0; i < size * size - 1; i++)
+        mCells[i] = i + 1;
+    mBlankIndex = size * size - 1;
+    mCells[mBlankIndex] = 0;
+    rehash();
+}
+
+void Board::rehash() {
+    mHash = 0;
+    for (int i = 0; i < mSize * mSize; i++)
+        mHash ^= zobrist(i, mCells[i]);
+}
+
+uint64_t Board::zobrist(const int index, const int value) {
+    // Dung splitmix64 thay cho bang so ngau nhien, khong can khoi tao
+    uint64_t z = ((uint64_t)index << 8 | (uint64_t)value) + 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+int Board::getSize() const {
+    return mSize;
+}
+
+int Board::getCell(const int row, const int col) const {
+    return mCells[row * mSize + col];
+}
+
+int Board::getCellAt(const int index) const {
+    return mCells[index];
+}
+
+int Board::getBlankRow() const {
+    return mBlankIndex / mSize;
+}
+
+int Board::getBlankCol() const {
+    return mBlankIndex % mSize;
+}
+
+int Board::getBlankIndex() const {
+    return mBlankIndex;
+}
+
+uint64_t Board::getHash() const {
+    return mHash;
+}
+
+bool Board::canMove(const Move move) const {
+    if (move == MOVE_NONE)
+        return false;
+    const int row = getBlankRow() + MOVE_DELTAS[move][0];
+    const int col = getBlankCol() + MOVE_DELTAS[move][1];
+    return (row >= 0 && row < mSize && col >= 0 && col < mSize);
+}
+
+bool Board::applyMove(const Move move) {
+    if (!canMove(move))
+        return false;
+
+    // Tile ke ben truot vao o trong, o trong chuyen sang vi tri cua tile
+    const int target = mBlankIndex + MOVE_DELTAS[move][0] * mSize + MOVE_DELTAS[move][1];
+    const int value = mCells[target];
+    mHash ^= zobrist(target, value) ^ zobrist(mBlankIndex, value);
+    mHash ^= zobrist(mBlankIndex, 0) ^ zobrist(target, 0);
+    mCells[mBlankIndex] = value;
+    mCells[target] = 0;
+    mBlankIndex = target;
+    return true;
+}
+
+Move Board::moveForTile(const int row, const int col) const {
+    for (int i = 0; i < 4; i++) {
+        if (getBlankRow() + MOVE_DELTAS[i][0] == row && getBlankCol() + MOVE_DELTAS[i][1] == col)
+            return (Move)i;
+    }
+    return MOVE_NONE;
+}
+
+bool Board::canSlide(const Slide& slide) const {
+    if (slide.move == MOVE_NONE || slide.count <= 0)
+        return false;
+    const int row = getBlankRow() + MOVE_DELTAS[slide.move][0] * slide.count;
+    const int col = getBlankCol() + MOVE_DELTAS[slide.move][1] * slide.count;
+    return (row >= 0 && row < mSize && col >= 0 && col < mSize);
+}
+
+bool Board::applySlide(const Slide& slide) {
+    if (!canSlide(slide))
+        return false;
+    for (int i = 0; i < slide.count; i++)
+        applyMove(slide.move);
+    return true;
+}
+
+Slide Board::slideForTile(const int row, const int col) const {
+    Slide slide = {MOVE_NONE, 0};
+    if (row == getBlankRow() && col != getBlankCol()) {
+        slide.move = (col > getBlankCol()) ? MOVE_RIGHT : MOVE_LEFT;
+        slide.count = abs(col - getBlankCol());
+    }
+    else if (col == getBlankCol() && row != getBlankRow()) {
+        slide.move = (row > getBlankRow()) ? MOVE_DOWN : MOVE_UP;
+        slide.count = abs(row - getBlankRow());
+    }
+    return slide;
+}
+
+bool Board::isSolved() const {
+    for (int i = 0; i < mSize * mSize - 1; i++) {
+        if (mCells[i] != i + 1)
+            return false;
+    }
+    return true;
+}
+
+bool Board::setCells(const vector<int>& cells) {
+    int size = 1;
+    while (size * size < (int)cells.size())
+        size++;
+    if (size < 2 || size * size != (int)cells.size())
+        return false;
+
+    vector<bool> seen(cells.size(), false);
+    for (const int value : cells) {
+        if (value < 0 || value >= (int)cells.size() || seen[value])
+            return false;
+        seen[value] = true;
+    }
+    mSize = size;
+    mCells.assign(cells.begin(), cells.end());
+    for (int i = 0; i < size * size; i++) {
+        if (mCells[i] == 0)
+            mBlankIndex = i;
+    }
+    rehash();
+    return true;
+}
+
+bool Board::isSolvable() const {
+    // Moi nuoc di doc doi so nghich the di mSize - 1 va doi hang cua o trong di mot,
+    // nen tong duoi day giu nguyen chan le; bang da xep cho tong bang 0
+    int parity = 0;
+    for (int i = 0; i < mSize * mSize; i++) {
+        for (int j = i + 1; j < mSize * mSize; j++) {
+            if (mCells[i] != 0 && mCells[j] != 0 && mCells[i] > mCells[j])
+                parity++;
+        }
+    }
+    if (mSize % 2 == 0)
+        parity += mSize - 1 - getBlankRow();
+    return parity % 2 == 0;
+}
+
+vector<Move> Board::shuffle(const unsigned int totalSwaps, Random& random) {
+    vector<Move> moves;
+    moves.reserve(totalSwaps);
+
+    for (unsigned int swap = 0; swap < totalSwaps; ++swap) {
+        // Chon ngau nhien mot nuoc di hop le cua o trong
+        Move legal[4];
+        int count = 0;
+        for (int i = 0; i < 4; i++) {
+            if (canMove((Move)i))
+                legal[count++] = (Move)i;
+        }
+        const Move move = legal[random.below(count)];
+        applyMove(move);
+        moves.push_back(move);
+    }
+    return moves;
+}
+
+bool Board::operator==(const Board& other) const {
+    return mSize == other.mSize && mBlankIndex == other.mBlankIndex && mCells == other.mCells;
+}
+
+bool Board::operator!=(const Board& other) const {
+    return !(*this == other);
+}
+
+vector<Move> invertMoves(const vector<Move>& moves) {
+    vector<Move> inverted;
+    inverted.reserve(moves.size());
+    for (auto it = moves.rbegin(); it != moves.rend(); ++it)
+        inverted.push_back(inverseMove(*it));
+    return inverted;
+}
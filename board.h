@@ -0,0 +1,79 @@
+#pragma once
+#include <vector>
+#include <stdint.h>
+#include "random.h"
+
+// Huong di chuyen cua o trong, cung thu tu voi mang deltas: len, phai, xuong, trai
+enum Move {
+    MOVE_UP = 0,
+    MOVE_RIGHT = 1,
+    MOVE_DOWN = 2,
+    MOVE_LEFT = 3,
+    MOVE_NONE = 4
+};
+
+static const int MOVE_DELTAS[4][2] = {{-1, 0}, {0, 1}, {1, 0}, {0, -1}};
+
+// Mot lan truot: count tile lien tiep tren cung hang (cot) truot vao o trong,
+// tuong duong count nuoc di move lien tiep cua o trong
+struct Slide {
+    Move move;
+    int count;
+};
+
+// Nuoc di nguoc lai cua mot nuoc di
+inline Move inverseMove(const Move move) {
+    return (move == MOVE_NONE) ? MOVE_NONE : (Move)((move + 2) % 4);
+}
+
+class Board {
+    // Mo hinh bang so, khong phu thuoc vao SDL
+    // Gia tri 0 la o trong, o (row, col) da dung vi tri khi gia tri bang row * size + col + 1
+    private:
+        int mSize;
+        std::vector<uint8_t> mCells;
+        int mBlankIndex;
+        uint64_t mHash;
+
+        void rehash();
+
+    public:
+        Board(const int size = 3);
+
+        int getSize() const;
+        int getCell(const int row, const int col) const;
+        int getCellAt(const int index) const;
+        int getBlankRow() const;
+        int getBlankCol() const;
+        int getBlankIndex() const;
+        uint64_t getHash() const;
+
+        bool canMove(const Move move) const;
+        bool applyMove(const Move move);
+        // Nuoc di dua tile o (row, col) vao o trong, MOVE_NONE neu khong ke nhau
+        Move moveForTile(const int row, const int col) const;
+
+        bool canSlide(const Slide& slide) const;
+        // Ap dung ca lan truot hoac khong gi ca neu khong hop le
+        bool applySlide(const Slide& slide);
+        // Lan truot day tile o (row, col) va cac tile giua no voi o trong, count = 0 neu khong cung hang/cot
+        Slide slideForTile(const int row, const int col) const;
+        bool isSolved() const;
+        // Dat bang theo danh sach gia tri tung hang (0 la o trong), kich thuoc suy ra tu so phan tu
+        // Tra ve false va giu nguyen bang neu danh sach khong phai hoan vi cua 0..n*n-1
+        bool setCells(const std::vector<int>& cells);
+        // Co the dua ve trang thai da xep hay khong (chan le cua hoan vi va hang cua o trong)
+        bool isSolvable() const;
+
+        // Dao bang bang cac nuoc di ngau nhien lay tu random, tra ve cac nuoc da di
+        std::vector<Move> shuffle(const unsigned int totalSwaps, Random& random);
+
+        bool operator==(const Board& other) const;
+        bool operator!=(const Board& other) const;
+
+        // Gia tri bam Zobrist cua gia tri value tai o index
+        static uint64_t zobrist(const int index, const int value);
+};
+
+// Dao nguoc mot chuoi nuoc di: di het chuoi nguoc lai thi tro ve trang thai ban dau
+std::vector<Move> invertMoves(const std::vector<Move>& moves);
@@ -18,6 +18,9 @@ void Button::changeColourTo(const SDL_Color& colour) {
     mColour = colour;
 }
 
-void Button::changeFontColourTo(const SDL_Color& fontColour){
+bool Button::changeFontColourTo(const SDL_Color& fontColour){
+    const bool changed = (mFontColour.r != fontColour.r || mFontColour.g != fontColour.g ||
+                          mFontColour.b != fontColour.b || mFontColour.a != fontColour.a);
     mFontColour = fontColour;
+    return changed;
 }
\ No newline at end of file
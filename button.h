@@ -9,6 +9,7 @@ class Button : public UserInterface {
         
         bool isMouseInside(const int x, const int y) const;
         void changeColourTo(const SDL_Colour& colour);
-        void changeFontColourTo(const SDL_Colour& fontColour);
+        // Tra ve true khi mau chu thay doi, luc do can load lai texture
+        bool changeFontColourTo(const SDL_Colour& fontColour);
 
 };
\ No newline at end of file
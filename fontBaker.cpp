@@ -0,0 +1,116 @@
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <iostream>
+#include <fstream>
+#include <map>
+#include <set>
+#include <vector>
+#include "layout.h"
+#include "bakedFont.h"
+
+using namespace std;
+
+// Cong cu luc build: ve san cac ky tu game dung o moi co chu (lay tu layout.h) thanh mot atlas alpha,
+// nen RLE roi ghi ra fontAtlasData.h de nhung vao file chay
+// Cach dung: fontBaker <file .ttf> <file .h dau ra>
+
+const int ATLAS_WIDTH = 1024;
+
+struct Glyph {
+    int size;
+    char character;
+    SDL_Surface* surface;
+    SDL_Rect rect;
+};
+
+int main(int argc, char* args[]) {
+    if (argc < 3) {
+        cout << "Usage: fontBaker <font.ttf> <output.h>" << endl;
+        return 1;
+    }
+    if (TTF_Init() == -1) {
+        cout << "TTF_Init Error: " << TTF_GetError() << endl;
+        return 1;
+    }
+
+    // Gop cac ky tu theo co chu, nhieu loai chu co the dung chung mot co
+    map<int, set<char>> charactersBySize;
+    for (const FontRequest& request : fontsToPreload(SCREEN_HEIGHT)) {
+        for (const char* c = request.characters; *c != '\0'; c++)
+            charactersBySize[request.size].insert(*c);
+    }
+
+    // Ve tung ky tu mau trang, xep len atlas theo tung hang
+    const SDL_Color WHITE = {255, 255, 255, 255};
+    vector<Glyph> glyphs;
+    int x = 0, y = 0, rowHeight = 0;
+    for (const auto& entry : charactersBySize) {
+        TTF_Font* font = TTF_OpenFont(args[1], entry.first);
+        if (font == nullptr) {
+            cout << "Failed to load font! Error: " << TTF_GetError() << endl;
+            return 1;
+        }
+        for (const char character : entry.second) {
+            SDL_Surface* rendered = TTF_RenderGlyph_Blended(font, (unsigned char)character, WHITE);
+            if (rendered == nullptr) {
+                cout << "Unable to render glyph! Error: " << TTF_GetError() << endl;
+                return 1;
+            }
+            SDL_Surface* surface = SDL_ConvertSurfaceFormat(rendered, SDL_PIXELFORMAT_RGBA32, 0);
+            SDL_FreeSurface(rendered);
+            if (surface == nullptr) {
+                cout << "Unable to convert glyph! Error: " << SDL_GetError() << endl;
+                return 1;
+            }
+            if (x + surface->w > ATLAS_WIDTH) {
+                x = 0;
+                y += rowHeight;
+                rowHeight = 0;
+            }
+            glyphs.push_back({entry.first, character, surface, {x, y, surface->w, surface->h}});
+            x += surface->w;
+            if (surface->h > rowHeight)
+                rowHeight = surface->h;
+        }
+        TTF_CloseFont(font);
+    }
+    const int atlasHeight = y + rowHeight;
+
+    // Chi giu kenh alpha, mau chu dat bang ColorMod luc chay
+    vector<unsigned char> alpha(ATLAS_WIDTH * atlasHeight, 0);
+    for (const Glyph& glyph : glyphs) {
+        for (int row = 0; row < glyph.rect.h; row++) {
+            const Uint8* pixels = (const Uint8*)glyph.surface->pixels + row * glyph.surface->pitch;
+            for (int col = 0; col < glyph.rect.w; col++)
+                alpha[(glyph.rect.y + row) * ATLAS_WIDTH + glyph.rect.x + col] = pixels[4 * col + 3];
+        }
+        SDL_FreeSurface(glyph.surface);
+    }
+    vector<unsigned char> compressed(bakedRleEncode(alpha.data(), alpha.size(), nullptr));
+    bakedRleEncode(alpha.data(), alpha.size(), compressed.data());
+
+    ofstream output(args[2]);
+    if (!output) {
+        cout << "Unable to write " << args[2] << endl;
+        return 1;
+    }
+    output << "// Sinh tu dong boi fontBaker tu " << args[1] << " va layout.h, khong sua tay\n";
+    output << "#pragma once\n#include \"bakedFont.h\"\n\n";
+    output << "const int BAKED_ATLAS_WIDTH = " << ATLAS_WIDTH << ";\n";
+    output << "const int BAKED_ATLAS_HEIGHT = " << atlasHeight << ";\n\n";
+    output << "constexpr BakedGlyph BAKED_GLYPHS[] = {\n";
+    for (const Glyph& glyph : glyphs) {
+        output << "    {" << glyph.size << ", " << (int)(unsigned char)glyph.character << ", " << glyph.rect.x << ", "
+               << glyph.rect.y << ", " << glyph.rect.w << ", " << glyph.rect.h << "},\n";
+    }
+    output << "};\n\n";
+    output << "constexpr unsigned char BAKED_ATLAS_RLE[] = {";
+    for (size_t i = 0; i < compressed.size(); i++)
+        output << (i % 16 == 0 ? "\n    " : " ") << (int)compressed[i] << ",";
+    output << "\n};\n";
+
+    cout << "Baked " << glyphs.size() << " glyphs in " << charactersBySize.size() << " sizes: "
+         << alpha.size() << " bytes -> " << compressed.size() << " bytes" << endl;
+    TTF_Quit();
+    return 0;
+}
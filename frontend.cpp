@@ -0,0 +1,29 @@
+// Phan SDL cua game la mot don vi dich: main va bench include file nay
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <time.h>
+// Loi cua game (bang, giai, do thoi gian...) nam trong libcore.a
+#include "allocCount.cpp"
+#include "tile.cpp"
+#include "stopwatch.cpp"
+#include "button.cpp"
+#include "userInterface.cpp"
+#include "SDL_utils.cpp"
+#include "startupProfile.cpp"
+#include "hint.cpp"
+#include "animator.cpp"
+#include "autoSolve.cpp"
+#include "glyphAtlas.cpp"
+#include "picture.cpp"
+#include "bakedFont.cpp"
+#include "resources.cpp"
+#include "menuScene.cpp"
+#include "puzzleScene.cpp"
+#include "menuView.cpp"
+#include "puzzleView.cpp"
+#include "renderThread.cpp"
+#include "sceneManager.cpp"
@@ -0,0 +1,126 @@
+#include <iostream>
+#include "glyphAtlas.h"
+#include "allocCount.h"
+#include "resources.h"
+
+using namespace std;
+
+GlyphAtlas::GlyphAtlas() {
+    mTexture = nullptr;
+    mOwnsTexture = false;
+    mHeight = 0;
+    for (int i = 0; i < NUMBER_OF_GLYPHS; i++)
+        mGlyphs[i] = {0, 0, 0, 0};
+}
+
+bool GlyphAtlas::load(SDL_Renderer* const renderer, TTF_Font* const font, const char* characters) {
+    free();
+
+    // Ve tung ky tu mau trang roi xep lien nhau tren mot surface
+    const SDL_Color WHITE = {255, 255, 255, 255};
+    SDL_Surface* glyphs[NUMBER_OF_GLYPHS] = {nullptr};
+    int width = 0;
+    for (const char* c = characters; *c != '\0'; c++) {
+        const int index = (unsigned char)*c;
+        if (index >= NUMBER_OF_GLYPHS || glyphs[index] != nullptr)
+            continue;
+        glyphs[index] = TTF_RenderGlyph_Blended(font, index, WHITE);
+        if (glyphs[index] == nullptr) {
+            cout << "Unable to render glyph! Error: " << TTF_GetError() << endl;
+            continue;
+        }
+        mGlyphs[index] = {width, 0, glyphs[index]->w, glyphs[index]->h};
+        width += glyphs[index]->w;
+        if (glyphs[index]->h > mHeight)
+            mHeight = glyphs[index]->h;
+    }
+
+    SDL_Surface* atlas = nullptr;
+    if (width > 0)
+        atlas = SDL_CreateRGBSurfaceWithFormat(0, width, mHeight, 32, SDL_PIXELFORMAT_RGBA32);
+    for (int i = 0; i < NUMBER_OF_GLYPHS; i++) {
+        if (glyphs[i] == nullptr)
+            continue;
+        if (atlas != nullptr) {
+            SDL_SetSurfaceBlendMode(glyphs[i], SDL_BLENDMODE_NONE);
+            SDL_BlitSurface(glyphs[i], nullptr, atlas, &mGlyphs[i]);
+        }
+        SDL_FreeSurface(glyphs[i]);
+    }
+
+    if (atlas == nullptr) {
+        cout << "Unable to create glyph atlas! Error: " << SDL_GetError() << endl;
+        return false;
+    }
+    mTexture = TRACK_TEXTURE(SDL_CreateTextureFromSurface(renderer, atlas));
+    SDL_FreeSurface(atlas);
+    if (mTexture == nullptr) {
+        cout << "Unable to create texture from glyph atlas! Error: " << SDL_GetError() << endl;
+        return false;
+    }
+    SDL_SetTextureBlendMode(mTexture, SDL_BLENDMODE_BLEND);
+    mOwnsTexture = true;
+    return true;
+}
+
+void GlyphAtlas::share(SDL_Texture* const texture) {
+    free();
+    mTexture = texture;
+    mOwnsTexture = false;
+}
+
+void GlyphAtlas::setGlyph(const char character, const SDL_Rect& rect) {
+    const int index = (unsigned char)character;
+    if (index >= NUMBER_OF_GLYPHS)
+        return;
+    mGlyphs[index] = rect;
+    if (rect.h > mHeight)
+        mHeight = rect.h;
+}
+
+int GlyphAtlas::measure(const char* text) const {
+    int width = 0;
+    for (const char* c = text; *c != '\0'; c++) {
+        const int index = (unsigned char)*c;
+        if (index < NUMBER_OF_GLYPHS)
+            width += mGlyphs[index].w;
+    }
+    return width;
+}
+
+int GlyphAtlas::getHeight() const {
+    return mHeight;
+}
+
+void GlyphAtlas::render(SDL_Renderer* const renderer, const char* text, const int x, const int y, const SDL_Color& colour) const {
+    if (mTexture == nullptr)
+        return;
+
+    ALLOW_SDL_ALLOCATIONS("glyph blit");
+    SDL_SetTextureColorMod(mTexture, colour.r, colour.g, colour.b);
+    SDL_Rect destination = {x, y, 0, 0};
+    for (const char* c = text; *c != '\0'; c++) {
+        const int index = (unsigned char)*c;
+        if (index >= NUMBER_OF_GLYPHS || mGlyphs[index].w == 0)
+            continue;
+        destination.w = mGlyphs[index].w;
+        destination.h = mGlyphs[index].h;
+        SDL_RenderCopy(renderer, mTexture, &mGlyphs[index], &destination);
+        destination.x += destination.w;
+    }
+}
+
+void GlyphAtlas::renderCentered(SDL_Renderer* const renderer, const char* text, const SDL_Rect& rect, const SDL_Color& colour) const {
+    // Can giua giong nhu UserInterface::centerText
+    render(renderer, text, rect.x + 0.5 * (rect.w - measure(text)), rect.y + 0.5 * (rect.h - mHeight), colour);
+}
+
+void GlyphAtlas::free() {
+    if (mTexture != nullptr && mOwnsTexture)
+        destroyTexture(mTexture);
+    mTexture = nullptr;
+    mOwnsTexture = false;
+    mHeight = 0;
+    for (int i = 0; i < NUMBER_OF_GLYPHS; i++)
+        mGlyphs[i] = {0, 0, 0, 0};
+}
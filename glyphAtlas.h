@@ -0,0 +1,29 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+class GlyphAtlas {
+    // Tat ca ky tu can ve nam tren mot texture trang, moi ky tu la mot vung (source rect)
+    // Mau chu duoc dat bang SDL_SetTextureColorMod nen doi mau khong can tao texture moi
+    private:
+        static const int NUMBER_OF_GLYPHS = 128;
+
+        SDL_Texture* mTexture;
+        // false khi texture la cua chung (font ve san), free() khong huy no
+        bool mOwnsTexture;
+        SDL_Rect mGlyphs[NUMBER_OF_GLYPHS];
+        int mHeight;
+
+    public:
+        GlyphAtlas();
+
+        bool load(SDL_Renderer* const renderer, TTF_Font* const font, const char* characters);
+        // Dung mot vung cua texture co san lam atlas, sau do them tung ky tu bang setGlyph
+        void share(SDL_Texture* const texture);
+        void setGlyph(const char character, const SDL_Rect& rect);
+        int measure(const char* text) const;
+        int getHeight() const;
+        void render(SDL_Renderer* const renderer, const char* text, const int x, const int y, const SDL_Color& colour) const;
+        void renderCentered(SDL_Renderer* const renderer, const char* text, const SDL_Rect& rect, const SDL_Color& colour) const;
+        void free();
+};
@@ -0,0 +1,106 @@
+#include "hint.h"
+#include "solver.h"
+#include "optimizer.h"
+#include "trace.h"
+
+using namespace std;
+
+HintSolver::HintSolver(const int size)
+    : mCancel(false), mSize(size), mBoard(size), mHasRequest(false), mRequestId(0),
+    mHasResult(false), mResult(MOVE_NONE), mQuit(false) {
+    mHistory.reserve(HISTORY_RESERVE);
+    mThread = thread(&HintSolver::run, this);
+}
+
+HintSolver::~HintSolver() {
+    {
+        lock_guard<mutex> lock(mMutex);
+        mQuit = true;
+        mCancel = true;
+    }
+    mCondition.notify_one();
+    mThread.join();
+}
+
+void HintSolver::request(const Board& board, const vector<Move>& history) {
+    {
+        lock_guard<mutex> lock(mMutex);
+        mBoard = board;
+        mHistory = history;
+        mHasRequest = true;
+        mRequestId++;
+        mHasResult = false;
+        mCancel = true;
+    }
+    mCondition.notify_one();
+}
+
+void HintSolver::cancel() {
+    lock_guard<mutex> lock(mMutex);
+    mHasRequest = false;
+    mRequestId++;
+    mHasResult = false;
+    mCancel = true;
+}
+
+bool HintSolver::poll(Move& hint) {
+    // Neu luong giai dang giu khoa thi de frame sau hoi lai
+    unique_lock<mutex> lock(mMutex, try_to_lock);
+    if (!lock.owns_lock() || !mHasResult)
+        return false;
+    hint = mResult;
+    mHasResult = false;
+    return true;
+}
+
+void HintSolver::run() {
+    traceThreadName("hint solver");
+    // Tao truoc pattern database de goi y 4x4 dau tien khong phai cho
+    if (mSize == 4)
+        preparePatternDatabase();
+
+    Board board(mSize);
+    // Hai vector doi cho cho nhau moi yeu cau nen ca hai deu du cho
+    vector<Move> history;
+    history.reserve(HISTORY_RESERVE);
+    while (true) {
+        unsigned int requestId;
+        {
+            unique_lock<mutex> lock(mMutex);
+            mCondition.wait(lock, [this]() { return mHasRequest || mQuit; });
+            if (mQuit)
+                return;
+            board = mBoard;
+            history.swap(mHistory);
+            requestId = mRequestId;
+            mHasRequest = false;
+            mCancel = false;
+        }
+
+        const Move hint = findHint(board, history);
+
+        lock_guard<mutex> lock(mMutex);
+        // Bo ket qua neu nguoi choi da di tiep trong luc dang giai
+        if (hint != MOVE_NONE && !mHasRequest && requestId == mRequestId) {
+            mResult = hint;
+            mHasResult = true;
+        }
+    }
+}
+
+Move HintSolver::findHint(const Board& board, const vector<Move>& history) {
+    TRACE_SCOPE("hint solve");
+    if (board.isSolved())
+        return MOVE_NONE;
+
+    const unsigned long long budget = (mSize <= 4) ? HINT_NODE_BUDGET_SMALL : HINT_NODE_BUDGET_LARGE;
+    const SolveResult result = solveOptimal(board, budget, &mCancel);
+    if (result.status == SOLVE_FOUND)
+        return result.moves.front();
+    if (result.status == SOLVE_CANCELLED)
+        return MOVE_NONE;
+
+    // history dua bang da xep ve trang thai hien tai nen dao nguoc lai la mot loi giai
+    const vector<Move> path = optimizeSolution(board, invertMoves(history));
+    return path.empty() ? MOVE_NONE : path.front();
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <vector>
+#include "board.h"
+
+// So nut toi da khi tim goi y toi uu: 3x3 luon du, 4x4 kho toi ~1 trieu nut mat ~60-90 ms (~80-90 ns/nut)
+// nen goi y van hien gan nhu ngay. Khong tim kip (va bang lon hon 4x4 gan nhu luon vay) thi dung
+// loi giai rut gon tu lich su nuoc di (dao nguoc lich su roi toi uu, ~1 ms)
+const unsigned long long HINT_NODE_BUDGET_SMALL = 1000000ULL;
+const unsigned long long HINT_NODE_BUDGET_LARGE = 2000000ULL;
+// Lich su nuoc di cua mot van binh thuong (dao bang va nuoc cua nguoi choi) vua trong so nay
+// nen chep lich su vao yeu cau goi y khong phai cap phat
+const size_t HISTORY_RESERVE = 4096;
+
+class HintSolver {
+    // Giai goi y tren mot luong rieng, vong lap game chi hoi ket qua chu khong bao gio cho
+    private:
+        std::thread mThread;
+        std::mutex mMutex;
+        std::condition_variable mCondition;
+        std::atomic<bool> mCancel;
+
+        int mSize;
+        Board mBoard;
+        std::vector<Move> mHistory;
+        bool mHasRequest;
+        unsigned int mRequestId;
+        bool mHasResult;
+        Move mResult;
+        bool mQuit;
+
+        void run();
+        Move findHint(const Board& board, const std::vector<Move>& history);
+
+    public:
+        HintSolver(const int size);
+        ~HintSolver();
+
+        // Gui yeu cau moi, yeu cau cu (neu dang giai) bi huy
+        void request(const Board& board, const std::vector<Move>& history);
+        void cancel();
+        // Khong chan: tra ve true khi da co goi y cho yeu cau gan nhat
+        bool poll(Move& hint);
+};
@@ -0,0 +1,57 @@
+#include <iostream>
+#include <fstream>
+#include "latency.h"
+
+using namespace std;
+
+LatencyHistogram::LatencyHistogram() {
+    for (auto& bucket : mBuckets)
+        bucket.store(0, memory_order_relaxed);
+}
+
+void LatencyHistogram::record(const uint32_t milliSeconds) {
+    const uint32_t bucket = (milliSeconds < (uint32_t)LATENCY_BUCKETS) ? milliSeconds : LATENCY_BUCKETS - 1;
+    mBuckets[bucket].fetch_add(1, memory_order_relaxed);
+}
+
+uint32_t LatencyHistogram::getCount() const {
+    uint32_t count = 0;
+    for (const auto& bucket : mBuckets)
+        count += bucket.load(memory_order_relaxed);
+    return count;
+}
+
+uint32_t LatencyHistogram::getPercentile(const double fraction) const {
+    // Hang gan nhat: mau thu ceil(fraction * count) khi sap xep tang dan
+    const uint32_t count = getCount();
+    if (count == 0)
+        return 0;
+    uint32_t rank = (uint32_t)(fraction * count);
+    if (rank < fraction * count)
+        rank++;
+    if (rank == 0)
+        rank = 1;
+
+    uint32_t seen = 0;
+    for (int i = 0; i < LATENCY_BUCKETS; i++) {
+        seen += mBuckets[i].load(memory_order_relaxed);
+        if (seen >= rank)
+            return i;
+    }
+    return LATENCY_BUCKETS - 1;
+}
+
+bool LatencyHistogram::write(const string& path, const string& label) const {
+    const uint32_t count = getCount();
+    if (count == 0)
+        return true;
+
+    ofstream output(path, ios::app);
+    if (!output) {
+        cout << "Unable to write " << path << endl;
+        return false;
+    }
+    output << label << " samples=" << count << " p50=" << getPercentile(0.5) << "ms p90=" << getPercentile(0.9)
+           << "ms p99=" << getPercentile(0.99) << "ms" << endl;
+    return true;
+}
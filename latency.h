@@ -0,0 +1,25 @@
+#pragma once
+#include <stdint.h>
+#include <atomic>
+#include <string>
+
+// Moi o cua histogram la 1 ms, o cuoi cung chua moi mau tu LATENCY_BUCKETS - 1 ms tro len
+const int LATENCY_BUCKETS = 1000;
+
+class LatencyHistogram {
+    // Histogram do tre tu input den luc hinh hien len (ms), khong khoa:
+    // ghi mot mau chi la mot fetch_add tren o cua no nen luong nao cung ghi duoc ma khong cho ai
+    // Khong goi SDL, gia tri do tre duoc tinh tu ngoai
+    private:
+        std::atomic<uint32_t> mBuckets[LATENCY_BUCKETS];
+
+    public:
+        LatencyHistogram();
+
+        void record(const uint32_t milliSeconds);
+        uint32_t getCount() const;
+        // Gia tri nho nhat ma it nhat fraction so mau nho hon hoac bang, 0 khi chua co mau
+        uint32_t getPercentile(const double fraction) const;
+        // Them mot dong p50/p90/p99 cua phien nay vao cuoi file, label mo ta cau hinh (vsync, fps...)
+        bool write(const std::string& path, const std::string& label) const;
+};
@@ -0,0 +1,62 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "resources.h"
+
+const std::string FONT_FILE = "DS-DIGIB.TTF";
+
+// Bo cuc cua menu va bang choi, dung chung khi tao giao dien, khi mo truoc font
+// va khi fontBaker ve san font luc build
+const unsigned int SCREEN_WIDTH = 410;
+const unsigned int SCREEN_HEIGHT = 600;
+const unsigned int MENU_ELEMENTS = 5;
+const unsigned int MENU_BORDER_THICKNESS = 20;
+const unsigned int PUZZLE_BORDER_THICKNESS = 5;
+const unsigned int MIN_DIFFICULTY = 3;
+const unsigned int MAX_DIFFICULTY = 6;
+
+// Cach ve tile: so tren nen mau, anh, hoac anh kem so
+enum TileMode {
+    TILE_MODE_NUMBERS,
+    TILE_MODE_PICTURE,
+    TILE_MODE_PICTURE_NUMBERS,
+    NUMBER_OF_TILE_MODES
+};
+const char* const TILE_MODE_TEXTS[NUMBER_OF_TILE_MODES] = {"Numbers", "Picture", "Pic+123"};
+
+// Cac ky tu moi loai chu thuc su dung, chi nhung ky tu nay duoc ve san
+const char* const MENU_GLYPHS = "3456x" "Numbers" "Picture" "Pic+123";
+const char* const TILE_GLYPHS = "0123456789";
+const char* const STOPWATCH_GLYPHS = "In danger " "0123456789:" "YOU'RE SAFE";
+const char* const BUTTON_GLYPHS = "Menu" "Hint" "Auto" "x124" "Max";
+
+constexpr unsigned int menuButtonHeight(const unsigned int SCREEN_HEIGHT) {
+    return (SCREEN_HEIGHT - (MENU_ELEMENTS + 1) * MENU_BORDER_THICKNESS) / MENU_ELEMENTS;
+}
+
+constexpr unsigned int puzzleTileWidth(const unsigned int DIFFICULTY, const unsigned int SCREEN_WIDTH) {
+    return (SCREEN_WIDTH - (DIFFICULTY + 1) * PUZZLE_BORDER_THICKNESS) / DIFFICULTY;
+}
+
+constexpr unsigned int puzzleTileHeight(const unsigned int DIFFICULTY, const unsigned int SCREEN_HEIGHT) {
+    // Hang tile, them dong ho bam gio va hang nut
+    return (SCREEN_HEIGHT - (DIFFICULTY + 3) * PUZZLE_BORDER_THICKNESS) / (DIFFICULTY + 2);
+}
+
+constexpr int menuFontSize(const unsigned int buttonHeight)     { return buttonHeight - 40; }
+constexpr int tileFontSize(const unsigned int tileHeight)       { return tileHeight - 40; }
+constexpr int stopwatchFontSize(const unsigned int tileHeight)  { return tileHeight / 3; }
+constexpr int buttonFontSize(const unsigned int tileHeight)     { return tileHeight / 2; }
+
+inline std::vector<FontRequest> fontsToPreload(const unsigned int SCREEN_HEIGHT) {
+    // Font cua menu truoc vi menu can ngay, sau do font cua moi do kho
+    std::vector<FontRequest> requests;
+    requests.push_back({FONT_FILE, menuFontSize(menuButtonHeight(SCREEN_HEIGHT)), MENU_GLYPHS});
+    for (unsigned int difficulty = MIN_DIFFICULTY; difficulty <= MAX_DIFFICULTY; difficulty++) {
+        const unsigned int tileHeight = puzzleTileHeight(difficulty, SCREEN_HEIGHT);
+        requests.push_back({FONT_FILE, tileFontSize(tileHeight), TILE_GLYPHS});
+        requests.push_back({FONT_FILE, stopwatchFontSize(tileHeight), STOPWATCH_GLYPHS});
+        requests.push_back({FONT_FILE, buttonFontSize(tileHeight), BUTTON_GLYPHS});
+    }
+    return requests;
+}
@@ -0,0 +1,104 @@
+#include "menuScene.h"
+#include "layout.h"
+
+using namespace std;
+
+// Mau sac cua menu
+const SDL_Color MENU_FONT_COLOUR = {255, 255, 255, 255}; // White
+const SDL_Color MENU_BUTTON_COLOUR = {0, 0, 0, 255}; // Black
+const SDL_Color MENU_BUTTON_DOWN_COLOUR = {50, 255, 100, 255}; // Green
+
+// Bon nut dau la do kho, nut cuoi cung doi cach ve tile
+const unsigned int NUMBER_OF_DIFFICULTIES = MAX_DIFFICULTY - MIN_DIFFICULTY + 1;
+
+MenuScene::MenuScene(const unsigned int SCREEN_WIDTH, const unsigned int SCREEN_HEIGHT)
+    : mTileMode(TILE_MODE_NUMBERS), mDifficulty(0), mNextScene(SCENE_NONE) {
+
+    // Kich thuoc cac nut bam cua bang menu
+    const unsigned int BORDER_THICKNESS = MENU_BORDER_THICKNESS;
+    const unsigned int BUTTON_WIDTH = SCREEN_WIDTH - 2 * BORDER_THICKNESS;
+    const unsigned int BUTTON_HEIGHT = menuButtonHeight(SCREEN_HEIGHT);
+
+    // Van ban tren menu
+    const char* buttonTexts[MENU_ELEMENTS] = {"3x3", "4x4", "5x5","6x6", TILE_MODE_TEXTS[mTileMode]};
+
+    int startX = BORDER_THICKNESS;
+    int startY = 0;
+    mButtons.reserve(MENU_ELEMENTS);
+    for (unsigned int row = 0; row < MENU_ELEMENTS; row++) {
+        startY += BORDER_THICKNESS;
+        SDL_Rect rect = {startX, startY, (int)BUTTON_WIDTH, (int)BUTTON_HEIGHT};
+        mButtons.emplace_back(rect, MENU_BUTTON_COLOUR, nullptr, MENU_FONT_COLOUR);
+        mButtons.back().setText(buttonTexts[row]);
+        startY += BUTTON_HEIGHT;
+    }
+}
+
+void MenuScene::enter() {
+    for (auto& button : mButtons)
+        button.changeColourTo(MENU_BUTTON_COLOUR);
+    mDifficulty = 0;
+    mNextScene = SCENE_NONE;
+}
+
+void MenuScene::handleEvent(const SDL_Event& event) {
+    // Khi con tro chuot duoc chon
+    if (event.type == SDL_MOUSEBUTTONDOWN) {
+        const int x = event.button.x;
+        const int y = event.button.y;
+        for (unsigned int i = 0; i < NUMBER_OF_DIFFICULTIES; i++) {
+            if (mButtons[i].isMouseInside(x, y)) {
+                mButtons[i].changeColourTo(MENU_BUTTON_DOWN_COLOUR);
+                // Vi du neu button 3*3 thi se co i = 0 nen difficulty = 3 -> map co do kho la 3*3
+                mDifficulty = i + MIN_DIFFICULTY;
+            }
+        }
+        Button& modeButton = mButtons[NUMBER_OF_DIFFICULTIES];
+        if (modeButton.isMouseInside(x, y)) {
+            modeButton.changeColourTo(MENU_BUTTON_DOWN_COLOUR);
+            mTileMode = (mTileMode + 1) % NUMBER_OF_TILE_MODES;
+            modeButton.setText(TILE_MODE_TEXTS[mTileMode]);
+        }
+    }
+    else if (event.type == SDL_MOUSEBUTTONUP) {
+        for (auto& button : mButtons)
+            button.changeColourTo(MENU_BUTTON_COLOUR);
+        // Khi do kho da duoc chon thi chuyen sang bang choi
+        if (mDifficulty != 0)
+            mNextScene = SCENE_PUZZLE;
+    }
+}
+
+void MenuScene::publish(FrameSnapshot& snapshot) const {
+    snapshot.scene = SCENE_MENU;
+    snapshot.size = 0;
+    snapshot.game = 0;
+    snapshot.solved = false;
+    snapshot.picture = false;
+    snapshot.showNumbers = false;
+    snapshot.staticVersion = 0;
+    snapshot.inputTime = 0;
+    snapshot.inputSequence = 0;
+    snapshot.count = 0;
+    for (unsigned int i = 0; i < mButtons.size(); i++)
+        snapshotElement(snapshot.elements[snapshot.count++], i, mButtons[i]);
+}
+
+SceneId MenuScene::nextScene() const {
+    return mNextScene;
+}
+
+void MenuScene::choose(const unsigned int difficulty, const unsigned int tileMode) {
+    mTileMode = tileMode;
+    mButtons[NUMBER_OF_DIFFICULTIES].setText(TILE_MODE_TEXTS[mTileMode]);
+    mDifficulty = difficulty;
+    mNextScene = SCENE_PUZZLE;
+}
+
+unsigned int MenuScene::getDifficulty() const {
+    return mDifficulty;
+}
+
+unsigned int MenuScene::getTileMode() const {
+    return mTileMode;
+}
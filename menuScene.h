@@ -0,0 +1,29 @@
+#pragma once
+#include <vector>
+#include <SDL2/SDL.h>
+#include "scene.h"
+#include "button.h"
+#include "snapshot.h"
+
+class MenuScene : public Scene {
+    // Menu chon do kho va cach ve tile, cac nut chi tao mot lan luc khoi dong
+    // Nut chi giu vi tri, mau va van ban; MenuView tren luong ve tao chu tu snapshot
+    private:
+        std::vector<Button> mButtons;
+        unsigned int mTileMode;
+        unsigned int mDifficulty;
+        SceneId mNextScene;
+
+    public:
+        MenuScene(const unsigned int SCREEN_WIDTH, const unsigned int SCREEN_HEIGHT);
+
+        void enter() override;
+        void handleEvent(const SDL_Event& event) override;
+        void publish(FrameSnapshot& snapshot) const override;
+        SceneId nextScene() const override;
+
+        // Nhu chon cach ve tile roi bam nut do kho (che do kiem tra khong co input)
+        void choose(const unsigned int difficulty, const unsigned int tileMode);
+        unsigned int getDifficulty() const;
+        unsigned int getTileMode() const;
+};
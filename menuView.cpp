@@ -0,0 +1,36 @@
+#include <string.h>
+#include "menuView.h"
+#include "layout.h"
+
+using namespace std;
+
+MenuView::MenuView(SDL_Renderer* const renderer, ResourceManager& resources, const FrameSnapshot& snapshot)
+    : mRenderer(renderer) {
+    mButtons.reserve(snapshot.count);
+    for (int i = 0; i < snapshot.count; i++) {
+        const ElementSnapshot& element = snapshot.elements[i];
+        // Font cua chu cua text, do ResourceManager so huu
+        const TextFace face = resources.getFace(FONT_FILE, menuFontSize(element.rect.h));
+        mButtons.emplace_back(element.rect, element.colour, face.font, element.fontColour);
+        mButtons.back().setGlyphAtlas(face.atlas);
+        mButtons.back().loadTexture(renderer, element.text);
+    }
+}
+
+void MenuView::apply(const FrameSnapshot& snapshot, const Uint32 renderTime) {
+    for (int i = 0; i < snapshot.count && i < (int)mButtons.size(); i++) {
+        const ElementSnapshot& element = snapshot.elements[i];
+        Button& button = mButtons[i];
+        button.changeColourTo(element.colour);
+        if (button.changeFontColourTo(element.fontColour) || strcmp(button.getText(), element.text) != 0)
+            button.loadTexture(mRenderer, element.text);
+    }
+}
+
+void MenuView::render() {
+    SDL_SetRenderDrawColor(mRenderer, 0, 0, 0, 255);
+    SDL_RenderClear(mRenderer);
+
+    for (const auto& button : mButtons)
+        button.render(mRenderer);
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include <vector>
+#include <SDL2/SDL.h>
+#include "sceneView.h"
+#include "button.h"
+#include "resources.h"
+
+class MenuView : public SceneView {
+    // Ve menu tren luong ve, cac nut tao tu snapshot dau tien
+    // Chu cua nut chi tao lai khi van ban hoac mau chu trong snapshot thay doi
+    private:
+        SDL_Renderer* mRenderer;
+        std::vector<Button> mButtons;
+
+    public:
+        MenuView(SDL_Renderer* const renderer, ResourceManager& resources, const FrameSnapshot& snapshot);
+
+        void apply(const FrameSnapshot& snapshot, const Uint32 renderTime) override;
+        void render() override;
+};
@@ -0,0 +1,32 @@
+#include "moveQueue.h"
+
+using namespace std;
+
+MoveQueue::MoveQueue(const size_t capacity)
+    : mSlides(capacity) {
+}
+
+bool MoveQueue::push(const Slide& slide) {
+    lock_guard<mutex> lock(mMutex);
+    return mSlides.push(slide);
+}
+
+bool MoveQueue::pop(Slide& slide) {
+    lock_guard<mutex> lock(mMutex);
+    return mSlides.pop(slide);
+}
+
+void MoveQueue::clear() {
+    lock_guard<mutex> lock(mMutex);
+    mSlides.clear();
+}
+
+size_t MoveQueue::size() const {
+    lock_guard<mutex> lock(mMutex);
+    return mSlides.size();
+}
+
+bool MoveQueue::empty() const {
+    lock_guard<mutex> lock(mMutex);
+    return mSlides.empty();
+}
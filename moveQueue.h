@@ -0,0 +1,23 @@
+#pragma once
+#include <mutex>
+#include "board.h"
+#include "ringBuffer.h"
+
+class MoveQueue {
+    // Hang doi cac lan truot dung chung giua luong tao loi giai va vong lap game
+    // Suc chua co dinh, cap phat mot lan luc tao nen vong lap game day va lay nuoc di khong cap phat
+    private:
+        mutable std::mutex mMutex;
+        RingBuffer<Slide> mSlides;
+
+    public:
+        MoveQueue(const size_t capacity);
+
+        // Tra ve false khi hang doi da day
+        bool push(const Slide& slide);
+        // Khong chan: tra ve false khi hang doi rong
+        bool pop(Slide& slide);
+        void clear();
+        size_t size() const;
+        bool empty() const;
+};
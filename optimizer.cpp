@@ -0,0 +1,185 @@
+#include <stdlib.h>
+#include <limits.h>
+#include <unordered_map>
+#include "optimizer.h"
+
+using namespace std;
+
+vector<Move> cancelInverseMoves(const vector<Move>& moves) {
+    // Dung vector nhu mot ngan xep: nuoc di nguoc voi dinh thi ca hai cung bi bo
+    vector<Move> result;
+    result.reserve(moves.size());
+    for (const Move move : moves) {
+        if (!result.empty() && result.back() == inverseMove(move))
+            result.pop_back();
+        else
+            result.push_back(move);
+    }
+    return result;
+}
+
+vector<Move> removeCycles(const Board& start, const vector<Move>& moves) {
+    // hashes[k] la gia tri bam cua bang sau k nuoc di cua result
+    vector<Move> result;
+    vector<uint64_t> hashes;
+    unordered_map<uint64_t, size_t> seen;
+    result.reserve(moves.size());
+    hashes.reserve(moves.size() + 1);
+    seen.reserve(moves.size() + 1);
+
+    Board board = start;
+    hashes.push_back(board.getHash());
+    seen[board.getHash()] = 0;
+
+    for (const Move move : moves) {
+        board.applyMove(move);
+        result.push_back(move);
+
+        auto found = seen.find(board.getHash());
+        if (found != seen.end()) {
+            // Quay ve trang thai da gap: cat bo ca vong lap, giu lai gia tri bam cua chinh trang thai do
+            const size_t keep = found->second;
+            while (hashes.size() > keep + 1) {
+                seen.erase(hashes.back());
+                hashes.pop_back();
+            }
+            result.resize(keep);
+        }
+        else {
+            hashes.push_back(board.getHash());
+            seen[board.getHash()] = result.size();
+        }
+    }
+    return result;
+}
+
+struct WindowSearch {
+    Board board;
+    vector<int> goalRow;
+    vector<int> goalCol;
+    vector<Move> path;
+    unsigned int nodes;
+    unsigned int budget;
+};
+
+static int tileDistance(const WindowSearch& search, const int index, const int value) {
+    const int size = search.board.getSize();
+    return abs(index / size - search.goalRow[value]) + abs(index % size - search.goalCol[value]);
+}
+
+static bool searchWindow(WindowSearch& search, const int g, const int h, const int bound,
+                         const Move previous, int& nextBound) {
+    // IDA* tu trang thai dau cua so den trang thai cuoi, h la tong khoang cach Manhattan
+    if (g + h > bound) {
+        if (g + h < nextBound)
+            nextBound = g + h;
+        return false;
+    }
+    if (h == 0)
+        return true;
+    if (++search.nodes > search.budget)
+        return false;
+
+    const int size = search.board.getSize();
+    for (int i = 0; i < 4; i++) {
+        const Move move = (Move)i;
+        if (move == inverseMove(previous) || !search.board.canMove(move))
+            continue;
+
+        const int blank = search.board.getBlankIndex();
+        const int target = blank + MOVE_DELTAS[i][0] * size + MOVE_DELTAS[i][1];
+        const int value = search.board.getCellAt(target);
+        const int newH = h - tileDistance(search, target, value) + tileDistance(search, blank, value);
+
+        search.board.applyMove(move);
+        search.path.push_back(move);
+        if (searchWindow(search, g + 1, newH, bound, move, nextBound))
+            return true;
+        search.path.pop_back();
+        search.board.applyMove(inverseMove(move));
+    }
+    return false;
+}
+
+static bool solveWindow(const Board& from, const Board& to, const int maxLength,
+                        const unsigned int nodeBudget, vector<Move>& path) {
+    // Tim doan nuoc di ngan hon maxLength tu from den to, bo cuoc khi het so nut cho phep
+    const int size = from.getSize();
+    WindowSearch search = {from, vector<int>(size * size), vector<int>(size * size), vector<Move>(), 0, nodeBudget};
+    for (int i = 0; i < size * size; i++) {
+        search.goalRow[to.getCellAt(i)] = i / size;
+        search.goalCol[to.getCellAt(i)] = i % size;
+    }
+
+    int h = 0;
+    for (int i = 0; i < size * size; i++) {
+        if (from.getCellAt(i) != 0)
+            h += tileDistance(search, i, from.getCellAt(i));
+    }
+
+    int bound = h;
+    while (bound < maxLength) {
+        int nextBound = INT_MAX;
+        if (searchWindow(search, 0, h, bound, MOVE_NONE, nextBound)) {
+            path = search.path;
+            return true;
+        }
+        if (search.nodes > search.budget || nextBound == INT_MAX)
+            break;
+        bound = nextBound;
+    }
+    return false;
+}
+
+vector<Move> shortenWindows(const Board& start, const vector<Move>& moves,
+                            const int windowSize, const unsigned int nodeBudget) {
+    // Them tung nuoc di vao cuoi ket qua, moi lan thu rut gon windowSize nuoc cuoi cung
+    vector<Move> result;
+    vector<Move> shorter;
+    result.reserve(moves.size());
+
+    Board board = start;
+    for (const Move move : moves) {
+        board.applyMove(move);
+        result.push_back(move);
+
+        bool shortened = true;
+        while (shortened && result.size() >= (size_t)windowSize) {
+            Board windowStart = board;
+            for (size_t k = result.size(); k > result.size() - windowSize; k--)
+                windowStart.applyMove(inverseMove(result[k - 1]));
+
+            shortened = solveWindow(windowStart, board, windowSize, nodeBudget, shorter);
+            if (shortened) {
+                result.resize(result.size() - windowSize);
+                result.insert(result.end(), shorter.begin(), shorter.end());
+            }
+        }
+    }
+    return result;
+}
+
+vector<Move> optimizeSolution(const Board& start, const vector<Move>& moves, const int windowSize) {
+    vector<Move> result = moves;
+    for (int pass = 0; pass < OPTIMIZER_MAX_PASSES; pass++) {
+        const size_t before = result.size();
+        result = cancelInverseMoves(result);
+        result = removeCycles(start, result);
+        result = shortenWindows(start, result, windowSize, OPTIMIZER_NODE_BUDGET);
+        if (result.size() == before)
+            break;
+    }
+
+    // Kiem tra lai ket qua (phong truong hop trung gia tri bam)
+    Board expected = start;
+    Board actual = start;
+    for (const Move move : moves)
+        expected.applyMove(move);
+    for (const Move move : result) {
+        if (!actual.applyMove(move))
+            return moves;
+    }
+    if (actual != expected)
+        return moves;
+    return result;
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include <vector>
+#include "board.h"
+
+// Kich thuoc cua so va so nut toi da khi giai lai moi cua so
+// Moi cua so ton toi da OPTIMIZER_NODE_BUDGET nut nen tong thoi gian tuyen tinh theo do dai chuoi
+const int OPTIMIZER_WINDOW = 12;
+const unsigned int OPTIMIZER_NODE_BUDGET = 20000;
+const int OPTIMIZER_MAX_PASSES = 3;
+
+// Bo cac cap nuoc di lien tiep triet tieu nhau (len roi xuong, trai roi phai)
+std::vector<Move> cancelInverseMoves(const std::vector<Move>& moves);
+
+// Bo cac doan nuoc di quay ve mot trang thai da gap, dua tren gia tri bam cua bang
+std::vector<Move> removeCycles(const Board& start, const std::vector<Move>& moves);
+
+// Giai lai toi uu tung cua so windowSize nuoc di, thay bang doan ngan nhat tim duoc
+std::vector<Move> shortenWindows(const Board& start, const std::vector<Move>& moves,
+                                 const int windowSize, const unsigned int nodeBudget);
+
+// Chay lan luot ca ba buoc tren den khi khong rut gon them duoc
+// Ket qua luon dua start ve cung trang thai voi chuoi ban dau
+std::vector<Move> optimizeSolution(const Board& start, const std::vector<Move>& moves,
+                                   const int windowSize = OPTIMIZER_WINDOW);
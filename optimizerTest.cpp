@@ -0,0 +1,127 @@
+// Kiem tra cac buoc rut gon loi giai: moi ket qua phai hop le, dua bang ve cung trang thai voi chuoi ban dau
+// va khong dai hon chuoi ban dau. Chi dung libcore, in loi va tra ve 1 khi co kiem tra sai
+#include <iostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "board.h"
+#include "optimizer.h"
+
+using namespace std;
+
+const unsigned int TEST_SEED = 2024;
+const int RANDOM_CASES = 20;
+const unsigned int RANDOM_MOVES = 200;
+const int LOOP_REPEATS = 9;
+
+static int failures = 0;
+static Random generator(TEST_SEED);
+
+static void check(const bool condition, const string& what) {
+    if (!condition) {
+        cout << "FAILED: " << what << endl;
+        failures++;
+    }
+}
+
+// Ap dung chuoi nuoc di, false neu co nuoc khong hop le
+static bool applyAll(Board& board, const vector<Move>& moves) {
+    for (const Move move : moves) {
+        if (!board.applyMove(move))
+            return false;
+    }
+    return true;
+}
+
+static void checkEquivalent(const Board& start, const vector<Move>& input, const vector<Move>& result,
+                            const string& what) {
+    Board expected = start;
+    Board actual = start;
+    applyAll(expected, input);
+    check(applyAll(actual, result), what + ": every move is legal");
+    check(actual == expected, what + ": reaches the same board");
+    check(result.size() <= input.size(), what + ": no longer than the input");
+}
+
+static vector<Move> squareLoop(const int repeats) {
+    // O trong di vong quanh mot o vuong 2x2 roi ve cho cu, moi vong 12 nuoc (cac tile xoay het mot vong)
+    vector<Move> moves;
+    for (int i = 0; i < repeats; i++) {
+        for (int turn = 0; turn < 3; turn++) {
+            moves.push_back(MOVE_UP);
+            moves.push_back(MOVE_LEFT);
+            moves.push_back(MOVE_DOWN);
+            moves.push_back(MOVE_RIGHT);
+        }
+    }
+    return moves;
+}
+
+static void testCancelInverseMoves() {
+    const Board start(4);
+    const vector<Move> pairs = {MOVE_UP, MOVE_DOWN, MOVE_LEFT, MOVE_RIGHT, MOVE_UP, MOVE_LEFT, MOVE_RIGHT, MOVE_DOWN};
+    const vector<Move> result = cancelInverseMoves(pairs);
+    checkEquivalent(start, pairs, result, "cancel inverse pairs");
+    check(result.empty(), "cancel inverse pairs: nested pairs cancel completely");
+
+    for (int i = 0; i < RANDOM_CASES; i++) {
+        Board board(4);
+        const vector<Move> moves = board.shuffle(RANDOM_MOVES, generator);
+        const vector<Move> cancelled = cancelInverseMoves(moves);
+        checkEquivalent(start, moves, cancelled, "cancel on a shuffle");
+        for (size_t k = 1; k < cancelled.size(); k++)
+            check(cancelled[k] != inverseMove(cancelled[k - 1]), "cancel on a shuffle: no adjacent inverse pair left");
+    }
+}
+
+static void testRemoveCycles() {
+    const Board start(4);
+    const vector<Move> loop = squareLoop(LOOP_REPEATS);
+    const vector<Move> result = removeCycles(start, loop);
+    checkEquivalent(start, loop, result, "repeated square loop");
+    check(result.empty(), "repeated square loop: every cycle removed");
+
+    for (int i = 0; i < RANDOM_CASES; i++) {
+        Board board(4);
+        const vector<Move> moves = board.shuffle(RANDOM_MOVES, generator);
+        const vector<Move> acyclic = removeCycles(start, moves);
+        checkEquivalent(start, moves, acyclic, "cycles on a shuffle");
+
+        // Khong trang thai nao lap lai trong ket qua
+        Board walk = start;
+        unordered_set<uint64_t> visited = {walk.getHash()};
+        bool repeated = false;
+        for (const Move move : acyclic) {
+            walk.applyMove(move);
+            repeated = repeated || !visited.insert(walk.getHash()).second;
+        }
+        check(!repeated, "cycles on a shuffle: no state visited twice");
+    }
+}
+
+static void testShortenWindows() {
+    // Di vong 2x2 mot lan roi them mot nuoc: cua so bao het vong lap phai rut ve mot nuoc
+    const Board start(4);
+    vector<Move> detour = squareLoop(1);
+    detour.push_back(MOVE_UP);
+    const vector<Move> shortened = shortenWindows(start, detour, (int)detour.size(), OPTIMIZER_NODE_BUDGET);
+    checkEquivalent(start, detour, shortened, "window over a detour");
+    check(shortened.size() == 1, "window over a detour: shortened to the single move");
+
+    for (int i = 0; i < RANDOM_CASES; i++) {
+        Board board(4);
+        const vector<Move> moves = board.shuffle(RANDOM_MOVES, generator);
+        checkEquivalent(start, moves, shortenWindows(start, moves, OPTIMIZER_WINDOW, OPTIMIZER_NODE_BUDGET),
+                        "windows on a shuffle");
+        checkEquivalent(start, moves, optimizeSolution(start, moves), "optimize a shuffle");
+    }
+}
+
+int main() {
+    testCancelInverseMoves();
+    testRemoveCycles();
+    testShortenWindows();
+    if (failures == 0)
+        cout << "All optimizer checks passed" << endl;
+    return (failures == 0) ? 0 : 1;
+}
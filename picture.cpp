@@ -0,0 +1,84 @@
+#include <iostream>
+#include <SDL2/SDL_image.h>
+#include "picture.h"
+#include "resources.h"
+#include "trace.h"
+
+using namespace std;
+
+PictureLoader::PictureLoader()
+    : mDone(false), mSurface(nullptr) {
+}
+
+PictureLoader::~PictureLoader() {
+    free();
+}
+
+void PictureLoader::start(const string& path) {
+    free();
+    mThread = thread(&PictureLoader::run, this, path);
+}
+
+void PictureLoader::run(const string path) {
+    traceThreadName("picture loader");
+    TRACE_SCOPE("decode picture");
+    SDL_Surface* loaded = IMG_Load(path.c_str());
+    if (loaded == nullptr)
+        cout << "Unable to load picture " << path << "! Error: " << IMG_GetError() << endl;
+    else {
+        // Doi sang mot dinh dang co dinh de SDL_BlitScaled khong phai chuyen doi moi lan
+        mSurface = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+        SDL_FreeSurface(loaded);
+    }
+    mDone.store(true, memory_order_release);
+}
+
+void PictureLoader::use(SDL_Surface* const surface) {
+    free();
+    mSurface = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_RGBA32, 0);
+    SDL_FreeSurface(surface);
+    mDone.store(true, memory_order_release);
+}
+
+bool PictureLoader::isReady() const {
+    return mDone.load(memory_order_acquire) && mSurface != nullptr;
+}
+
+SDL_Texture* PictureLoader::getTexture(SDL_Renderer* const renderer, const int width, const int height) {
+    if (!isReady())
+        return nullptr;
+    TRACE_SCOPE("picture texture");
+    // Moi bang choi giu texture cua minh, doi kich thuoc bang khong huy texture cua bang khac
+    auto found = mTextures.find({width, height});
+    if (found != mTextures.end())
+        return found->second;
+
+    SDL_Surface* scaled = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGBA32);
+    if (scaled == nullptr || SDL_BlitScaled(mSurface, nullptr, scaled, nullptr) != 0) {
+        cout << "Unable to scale picture! Error: " << SDL_GetError() << endl;
+        SDL_FreeSurface(scaled);
+        return nullptr;
+    }
+
+    SDL_Texture* texture = TRACK_TEXTURE(SDL_CreateTextureFromSurface(renderer, scaled));
+    SDL_FreeSurface(scaled);
+    if (texture == nullptr) {
+        cout << "Unable to create texture from picture! Error: " << SDL_GetError() << endl;
+        return nullptr;
+    }
+    mTextures[{width, height}] = texture;
+    return texture;
+}
+
+void PictureLoader::free() {
+    if (mThread.joinable())
+        mThread.join();
+    mDone = false;
+    for (auto& texture : mTextures)
+        destroyTexture(texture.second);
+    mTextures.clear();
+    if (mSurface != nullptr) {
+        SDL_FreeSurface(mSurface);
+        mSurface = nullptr;
+    }
+}
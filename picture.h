@@ -0,0 +1,32 @@
+#pragma once
+#include <string>
+#include <thread>
+#include <atomic>
+#include <map>
+#include <utility>
+#include <SDL2/SDL.h>
+
+class PictureLoader {
+    // Giai ma anh bang IMG_Load tren luong rieng trong luc menu dang hien
+    // Texture chi duoc tao tren luong ve (luong so huu renderer), co gian mot lan cho moi kich thuoc bang
+    private:
+        std::thread mThread;
+        std::atomic<bool> mDone;
+        SDL_Surface* mSurface;
+        std::map<std::pair<int, int>, SDL_Texture*> mTextures;
+
+        void run(const std::string path);
+
+    public:
+        PictureLoader();
+        ~PictureLoader();
+
+        void start(const std::string& path);
+        // Dung surface co san thay cho file anh (renderCheck tu ve anh kiem tra), loader giai phong surface
+        void use(SDL_Surface* const surface);
+        // true khi da giai ma xong va thanh cong, khong bao gio cho
+        bool isReady() const;
+        // Texture cua anh da co gian ve width x height, nullptr neu anh chua san sang
+        SDL_Texture* getTexture(SDL_Renderer* const renderer, const int width, const int height);
+        void free();
+};
@@ -0,0 +1,598 @@
+#include <stdio.h>
+#include <iostream>
+#include <algorithm>
+#include <string>
+#include "puzzleScene.h"
+#include "optimizer.h"
+#include "layout.h"
+#include "trace.h"
+
+using namespace std;
+
+// Dinh nghia cac mau sac o giao dien
+const SDL_Color TILE_COLOUR = {0, 20, 50, 255};
+const SDL_Color TILE_COMPLETION_COLOUR = {102, 178, 19, 0}; // Green
+const SDL_Color FONT_COLOUR = {255, 0, 0, 255}; // Led red
+const SDL_Color FONT_COMPLETION_COLOUR = {255, 255, 255, 255}; // White
+const SDL_Color BUTTON_COLOUR = {0, 20, 50, 255};
+const SDL_Color BUTTON_DOWN_COLOUR = {102, 178, 19, 0}; // Green
+const SDL_Color HINT_COLOUR = {255, 200, 0, 255}; // Yellow
+
+// Tong so lan swap khi dao bang
+const unsigned int TOTAL_SWAPS = 1000;
+
+// Toc do tu giai (nuoc moi giay), 0 la moi frame mot nuoc, nhanh nhat ma vsync cho phep
+// Bam "Auto" lan dau de bat dau, cac lan sau doi toc do
+const unsigned int NUMBER_OF_AUTO_SPEEDS = 4;
+const unsigned int AUTO_SPEEDS[NUMBER_OF_AUTO_SPEEDS] = {4, 8, 16, 0};
+const char* const AUTO_SPEED_TEXTS[NUMBER_OF_AUTO_SPEEDS] = {"x1", "x2", "x4", "Max"};
+
+// Hang doi nuoc di cua nguoi choi: nhan input ca khi tile dang chay
+// mPlannedBoard la trang thai sau khi chay het nuoc dang chay va cac nuoc trong hang doi,
+// moi nuoc moi duoc kiem tra tren trang thai nay. Hang doi sau tu INPUT_INSTANT_DEPTH thi di ngay khong animation
+const size_t INPUT_QUEUE_CAPACITY = 8;
+const size_t INPUT_INSTANT_DEPTH = 3;
+
+// So thu tu cua lan truot cua nguoi choi, dung chung cho moi bang choi de luong ve khong lan hai lan truot
+// cua hai bang khac nhau (chi doi tren luong mo phong)
+static unsigned int slideInputCount = 0;
+
+// Du cho so lan truot cua mot van binh thuong, them nuoc khong phai cap phat lai
+const size_t THINK_TIMES_RESERVE = 512;
+
+// Toc do truot cua tile
+const unsigned int PIXELS_PER_SECOND = 500;
+
+// Keo qua nguong nay (pixel) moi tinh la keo, khong thi la mot lan bam
+const int DRAG_THRESHOLD = 4;
+
+// Lan truot dang chay animation (count = 0 khi dung yen)
+const Slide NO_SLIDE = {MOVE_NONE, 0};
+
+static inline bool inMap(const int row, const int col, const int maxRow, const int maxCol) {
+    return (row >= 0 && row <= maxRow && col >= 0 && col <= maxCol);
+}
+
+static Move moveForKey(const SDL_Keycode key) {
+    // Phim mui ten chi huong tile di chuyen, o trong di theo huong nguoc lai
+    switch (key) {
+        case SDLK_UP:       return MOVE_DOWN;
+        case SDLK_DOWN:     return MOVE_UP;
+        case SDLK_LEFT:     return MOVE_RIGHT;
+        case SDLK_RIGHT:    return MOVE_LEFT;
+        default:            return MOVE_NONE;
+    }
+}
+
+static Move moveForControllerButton(const Uint8 button) {
+    // Giong phim mui ten nhung dung D-pad cua tay cam
+    switch (button) {
+        case SDL_CONTROLLER_BUTTON_DPAD_UP:     return MOVE_DOWN;
+        case SDL_CONTROLLER_BUTTON_DPAD_DOWN:   return MOVE_UP;
+        case SDL_CONTROLLER_BUTTON_DPAD_LEFT:   return MOVE_RIGHT;
+        case SDL_CONTROLLER_BUTTON_DPAD_RIGHT:  return MOVE_LEFT;
+        default:                                return MOVE_NONE;
+    }
+}
+
+PuzzleScene::PuzzleScene(const PictureLoader& picture, TelemetryWriter& telemetry, FrameStats& frameStats, const int size,
+                         const unsigned int SCREEN_WIDTH, const unsigned int SCREEN_HEIGHT)
+    : mPicture(picture), mTelemetry(telemetry), mFrameStats(frameStats), mSize(size),
+      mScreenWidth(SCREEN_WIDTH), mScreenHeight(SCREEN_HEIGHT), mBorder(PUZZLE_BORDER_THICKNESS),
+      mTileWidth(puzzleTileWidth(size, SCREEN_WIDTH)), mTileHeight(puzzleTileHeight(size, SCREEN_HEIGHT)),
+      mTilesTop(mBorder + mTileHeight + mBorder),
+      mHorizontalSlideTime((mTileWidth + mBorder) * 1000 / PIXELS_PER_SECOND),
+      mVerticalSlideTime((mTileHeight + mBorder) * 1000 / PIXELS_PER_SECOND),
+      mEmptyTile(nullptr),
+      mMenuButton(buttonRect(0), BUTTON_COLOUR, nullptr, FONT_COLOUR),
+      mHintButton(buttonRect(1), BUTTON_COLOUR, nullptr, FONT_COLOUR),
+      mAutoButton(buttonRect(2), BUTTON_COLOUR, nullptr, FONT_COLOUR),
+      mGame(0), mPictureMode(false), mShowNumbers(true), mStaticVersion(0),
+      mBoard(size), mHintSolver(size), mHintPending(false),
+      mAutoSpeed(0), mAutoSolving(false), mAutoSolveQueued(false), mSolutionQueue(AUTO_SOLVE_QUEUE_CAPACITY),
+      mAutoSolver(mSolutionQueue), mInputQueue(INPUT_QUEUE_CAPACITY), mInputTimes(INPUT_QUEUE_CAPACITY), mSlideInputTime(0), mSlideInputSequence(0), mPlannedBoard(size), mNow(0), mMovingSlide(NO_SLIDE),
+      mDragging(false), mDragSlide(NO_SLIDE), mDragStartX(0), mDragStartY(0), mDragX(0), mDragY(0), mDragStartTime(0),
+      mSessionOpen(false), mSessionStart(0), mLastInputTime(0),
+      mCheckSolved(false), mSolved(false), mMenuButtonPressed(false), mNextScene(SCENE_NONE) {
+
+    // Tao ra cac tile o vi tri da xep xong, van moi se xep lai chung theo mo hinh
+    mTiles.reserve(mSize);
+    for (int row = 0; row < mSize; row++) {
+        mTiles.emplace_back();
+        vector<Tile>& tileRow = mTiles.back();
+        tileRow.reserve(mSize);
+        for (int col = 0; col < mSize; col++) {
+            const int number = row * mSize + col + 1;
+            const SDL_Rect rect = {tileX(col), tileY(row), mTileWidth, mTileHeight};
+            tileRow.emplace_back(rect, TILE_COLOUR, nullptr, FONT_COLOUR, number);
+            char text[4];
+            snprintf(text, sizeof(text), "%d", number);
+            tileRow.back().setText(text);
+        }
+    }
+    mEmptyTile = &mTiles[mSize - 1][mSize - 1];
+
+    mMenuButton.setText("Menu");
+    mHintButton.setText("Hint");
+    mAutoButton.setText("Auto");
+}
+
+PuzzleScene::~PuzzleScene() {
+    mAutoSolver.stop();
+}
+
+SDL_Rect PuzzleScene::buttonRect(const int index) const {
+    // Ba nut "Menu", "Hint" va "Auto" nam canh nhau o hang cuoi
+    const int buttonWidth = (mScreenWidth - 4 * mBorder) / 3;
+    return {mBorder + index * (buttonWidth + mBorder), tileY(mSize), buttonWidth, mTileHeight};
+}
+
+// Toa do cua o (row, col) tren man hinh
+int PuzzleScene::tileX(const int col) const {
+    return mBorder + col * (mTileWidth + mBorder);
+}
+
+int PuzzleScene::tileY(const int row) const {
+    return mTilesTop + row * (mTileHeight + mBorder);
+}
+
+bool PuzzleScene::cellAt(const int x, const int y, int& row, int& col) const {
+    // Tim o (row, col) chua diem (x, y) bang phep chia thay vi duyet tung tile, false neu roi vao vien
+    if (x < mBorder || y < mTilesTop)
+        return false;
+    col = (x - mBorder) / (mTileWidth + mBorder);
+    row = (y - mTilesTop) / (mTileHeight + mBorder);
+    if (!inMap(row, col, mSize - 1, mSize - 1))
+        return false;
+    return (x < tileX(col) + mTileWidth && y < tileY(row) + mTileHeight);
+}
+
+SDL_Point PuzzleScene::cellCentre(const int row, const int col) const {
+    return {tileX(col) + mTileWidth / 2, tileY(row) + mTileHeight / 2};
+}
+
+const SDL_Rect& PuzzleScene::getHintButtonRect() const {
+    return mHintButton.getRect();
+}
+
+Uint32 PuzzleScene::slideTime(const Slide& slide) const {
+    return (slide.move == MOVE_LEFT || slide.move == MOVE_RIGHT) ? mHorizontalSlideTime : mVerticalSlideTime;
+}
+
+void PuzzleScene::paintTile(Tile& tile, const SDL_Color& colour, const SDL_Color& fontColour) {
+    tile.changeColourTo(colour);
+    tile.changeFontColourTo(fontColour);
+}
+
+bool PuzzleScene::paintTiles() {
+    // Tile nao dung vi tri thi chuyen sang mau chinh xac, tra ve true khi ca bang da dung
+    bool solved = true;
+    for (int row = 0; row < mSize; row++) {
+        for (int col = 0; col < mSize; col++) {
+            const int number = row * mSize + col + 1;
+            if (mTiles[row][col].getNumber() == number)
+                paintTile(mTiles[row][col], TILE_COMPLETION_COLOUR, FONT_COMPLETION_COLOUR);
+            else {
+                paintTile(mTiles[row][col], BUTTON_COLOUR, FONT_COLOUR);
+                solved = false;
+            }
+        }
+    }
+    return solved;
+}
+
+void PuzzleScene::newGame(const unsigned int tileMode, const unsigned int seed) {
+    // Dung cac luong va hang doi cua van truoc
+    endSession();
+    mAutoSolver.stop();
+    mSolutionQueue.clear();
+    mHintSolver.cancel();
+    mInputQueue.clear();
+    mInputTimes.clear();
+    mSlideInputTime = 0;
+    mSlideInputSequence = 0;
+    mAnimator.clear();
+    mHintPending = false;
+    mAutoSpeed = 0;
+    mAutoSolving = false;
+    mAutoSolveQueued = false;
+    mMovingSlide = NO_SLIDE;
+    mDragging = false;
+    mDragSlide = NO_SLIDE;
+    mCheckSolved = false;
+    mSolved = false;
+    mMenuButtonPressed = false;
+    mNextScene = SCENE_NONE;
+
+    // Dao bang so tren mo hinh, cac tile se duoc xep theo mo hinh nay
+    // Moi van co seed rieng de ban ghi telemetry dung lai duoc bang nay
+    Random random(seed);
+    mBoard = Board(mSize);
+    mHistory = mBoard.shuffle(TOTAL_SWAPS, random);
+    mHistory.reserve(HISTORY_RESERVE);
+    mPlannedBoard = mBoard;
+
+    // Loi giai tu viec dao nguoc qua trinh dao bang, rut gon lai de lam so nuoc "par"
+    const vector<Move> parSolution = optimizeSolution(mBoard, invertMoves(mHistory));
+
+    mSession.size = mSize;
+    mSession.seed = seed;
+    mSession.solved = false;
+    mSession.autoSolved = false;
+    mSession.hints = 0;
+    mSession.moves = 0;
+    mSession.par = parSolution.size();
+    mSession.start = mBoard;
+    mSession.thinkTimes.clear();
+    mSession.thinkTimes.reserve(THINK_TIMES_RESERVE);
+    mSessionStart = mLastInputTime = SDL_GetTicks();
+    mFrameStats.reset();
+    mSessionOpen = true;
+
+    // Xep lai cac tile da co theo mo hinh moi, so cua tile lay tu mo hinh, o trong mang so cuoi cung
+    vector<Tile> byNumber;
+    byNumber.reserve(mSize * mSize);
+    for (auto& tileRow : mTiles) {
+        for (auto& tile : tileRow)
+            byNumber.push_back(move(tile));
+    }
+    sort(byNumber.begin(), byNumber.end(), [](const Tile& a, const Tile& b) { return a.getNumber() < b.getNumber(); });
+    for (int row = 0; row < mSize; row++) {
+        for (int col = 0; col < mSize; col++) {
+            const int cell = mBoard.getCell(row, col);
+            mTiles[row][col] = move(byNumber[(cell == 0 ? mSize * mSize : cell) - 1]);
+            mTiles[row][col].setPositionTo(tileX(col), tileY(row));
+        }
+    }
+    mEmptyTile = &mTiles[mBoard.getBlankRow()][mBoard.getBlankCol()];
+
+    // Che do xep hinh: anh chua giai ma xong (hoac khong co) thi choi bang so nhu binh thuong
+    // Texture cua anh do luong ve tao khi thay van moi trong snapshot
+    mPictureMode = (tileMode != TILE_MODE_NUMBERS && mPicture.isReady());
+    if (tileMode != TILE_MODE_NUMBERS && !mPictureMode)
+        cout << "Picture is not available, playing with numbers" << endl;
+    mShowNumbers = (!mPictureMode || tileMode == TILE_MODE_PICTURE_NUMBERS);
+
+    paintTiles();
+
+    // Cac nut tro lai mau va nhan ban dau
+    mMenuButton.changeColourTo(BUTTON_COLOUR);
+    mMenuButton.changeFontColourTo(FONT_COLOUR);
+    mHintButton.changeColourTo(BUTTON_COLOUR);
+    mHintButton.changeFontColourTo(FONT_COLOUR);
+    mAutoButton.changeColourTo(BUTTON_COLOUR);
+    mAutoButton.changeFontColourTo(FONT_COLOUR);
+    mAutoButton.setText("Auto");
+
+    // Luong ve thay van moi thi bat dau lai dong ho
+    mGame++;
+    mStaticVersion++;
+}
+
+void PuzzleScene::leave() {
+    // Khong de luong giai chay tiep khi nguoi choi da ve menu
+    mAutoSolver.stop();
+    mHintSolver.cancel();
+    endSession();
+}
+
+void PuzzleScene::markSlideInput(const Uint32 inputTime) {
+    mSlideInputTime = inputTime;
+    mSlideInputSequence = ++slideInputCount;
+}
+
+void PuzzleScene::recordPlayerSlide(const Slide& slide, const Uint32 inputTime) {
+    // Thoi gian suy nghi tinh tu lan truot truoc (hoac luc bat dau van) den input cua lan nay
+    mSession.moves += slide.count;
+    mSession.thinkTimes.push_back(inputTime > mLastInputTime ? inputTime - mLastInputTime : 0);
+    mLastInputTime = inputTime;
+}
+
+void PuzzleScene::endSession() {
+    // Chi dua ban ghi vao hang doi, TelemetryWriter ghi file tren luong cua no
+    if (!mSessionOpen)
+        return;
+    mSessionOpen = false;
+    mSession.solved = mSolved;
+    mSession.totalTime = SDL_GetTicks() - mSessionStart;
+    mSession.frames = mFrameStats.getCount();
+    mSession.frameMean = mFrameStats.getMean();
+    mSession.frameMax = mFrameStats.getMax();
+    mTelemetry.submit(move(mSession));
+}
+
+void PuzzleScene::queueSlide(const Slide& slide, const Uint32 timestamp) {
+    // Them lan truot cua nguoi choi vao hang doi neu hop le tren trang thai ma no se duoc ap dung
+    // timestamp cua su kien di kem de do do tre den luc tile bat dau chay tren man hinh
+    if (!mPlannedBoard.canSlide(slide))
+        return;
+    if (mInputQueue.push(slide)) {
+        mPlannedBoard.applySlide(slide);
+        mInputTimes.push(timestamp);
+    }
+}
+
+void PuzzleScene::clearInputQueue() {
+    mInputQueue.clear();
+    mInputTimes.clear();
+    mPlannedBoard = mBoard;
+    mPlannedBoard.applySlide(mMovingSlide);
+}
+
+void PuzzleScene::startSlide(const Slide& slide, const Uint32 duration) {
+    // Bat dau truot ca day tile vao o trong cung mot luc, moi tile di mot o
+    // duration = 0 thi xong ngay o lan update dau tien
+    mMovingSlide = slide;
+    mStaticVersion++;
+    mAnimator.clear();
+    for (int i = 1; i <= slide.count; i++) {
+        const int row = mBoard.getBlankRow() + MOVE_DELTAS[slide.move][0] * i;
+        const int col = mBoard.getBlankCol() + MOVE_DELTAS[slide.move][1] * i;
+        mAnimator.add(&mTiles[row][col], tileX(col - MOVE_DELTAS[slide.move][1]), tileY(row - MOVE_DELTAS[slide.move][0]));
+    }
+    mAnimator.start(mNow, duration);
+}
+
+void PuzzleScene::finishSlide() {
+    // Cac tile da den noi: day empty tile qua tung o trong mang, dat no vao cho cua tile cuoi
+    // Lich su van ghi tung nuoc di don de so nuoc di khong doi so voi di tung tile mot
+    for (int i = 0; i < mMovingSlide.count; i++) {
+        const int row = mBoard.getBlankRow() + MOVE_DELTAS[mMovingSlide.move][0];
+        const int col = mBoard.getBlankCol() + MOVE_DELTAS[mMovingSlide.move][1];
+        iter_swap(&mTiles[row][col], mEmptyTile);
+        mEmptyTile = &mTiles[row][col];
+        mEmptyTile->setPositionTo(tileX(col), tileY(row));
+        mBoard.applyMove(mMovingSlide.move);
+        mHistory.push_back(mMovingSlide.move);
+    }
+    mMovingSlide = NO_SLIDE;
+    // Nguoi choi di truoc khi co goi y: giai lai cho bang moi
+    if (mHintPending)
+        mHintSolver.request(mBoard, mHistory);
+    mCheckSolved = true;
+}
+
+// Keo tha: day tile mDragSlide di theo con tro, chi theo truc cua no va khong qua mot o
+// SDL_MOUSEMOTION chi luu vi tri moi nhat, vi tri tile duoc tinh mot lan moi frame
+// Nha chuot khi da keo qua nua o thi truot not, chua den thi tra ve cho cu
+int PuzzleScene::dragCellSize() const {
+    return ((mDragSlide.move == MOVE_LEFT || mDragSlide.move == MOVE_RIGHT) ? mTileWidth : mTileHeight) + mBorder;
+}
+
+int PuzzleScene::dragDistance() const {
+    // Quang duong keo theo huong tile di chuyen (nguoc huong o trong), gioi han trong [0, mot o]
+    const int distance = -(mDragX - mDragStartX) * MOVE_DELTAS[mDragSlide.move][1] - (mDragY - mDragStartY) * MOVE_DELTAS[mDragSlide.move][0];
+    return max(0, min(distance, dragCellSize()));
+}
+
+void PuzzleScene::placeDraggedTiles(const int distance) {
+    for (int i = 1; i <= mDragSlide.count; i++) {
+        const int row = mBoard.getBlankRow() + MOVE_DELTAS[mDragSlide.move][0] * i;
+        const int col = mBoard.getBlankCol() + MOVE_DELTAS[mDragSlide.move][1] * i;
+        mTiles[row][col].setPositionTo(tileX(col) - MOVE_DELTAS[mDragSlide.move][1] * distance,
+                                       tileY(row) - MOVE_DELTAS[mDragSlide.move][0] * distance);
+    }
+}
+
+bool PuzzleScene::isLiveTile(const int row, const int col) const {
+    // Tile dang truot hoac dang bi keo, ve rieng moi frame chu khong nam trong backdrop
+    const Slide& slide = mDragging ? mDragSlide : mMovingSlide;
+    for (int i = 1; i <= slide.count; i++) {
+        if (row == mBoard.getBlankRow() + MOVE_DELTAS[slide.move][0] * i &&
+            col == mBoard.getBlankCol() + MOVE_DELTAS[slide.move][1] * i)
+            return true;
+    }
+    return false;
+}
+
+void PuzzleScene::handleEvent(const SDL_Event& event) {
+    // Bam chuot co the doi mau nut hoac bat dau keo, texture cua render target co the bi mat khi doi thiet bi
+    if (event.type == SDL_MOUSEBUTTONDOWN || event.type == SDL_MOUSEBUTTONUP ||
+        event.type == SDL_RENDER_TARGETS_RESET)
+        mStaticVersion++;
+
+    // Nuoc di cua nguoi choi vao hang doi bat ke tile co dang chay hay khong
+    // Chi nut trai cua chuot bam nut, bam tile va keo tile
+    const bool acceptMoves = !mSolved && !mAutoSolving && !mDragging;
+    if (event.type == SDL_KEYDOWN && acceptMoves && event.key.repeat == 0)
+        queueSlide({moveForKey(event.key.keysym.sym), 1}, event.key.timestamp);
+    else if (event.type == SDL_CONTROLLERBUTTONDOWN && acceptMoves)
+        queueSlide({moveForControllerButton(event.cbutton.button), 1}, event.cbutton.timestamp);
+    else if (event.type == SDL_MOUSEBUTTONDOWN && event.button.button == SDL_BUTTON_LEFT) {
+        const int x = event.button.x;
+        const int y = event.button.y;
+        int row, col;
+        if (acceptMoves && cellAt(x, y, row, col)) {
+            // Chi keo duoc khi bang dung yen, con khong thi xem nhu mot lan bam
+            const Slide slide = mPlannedBoard.slideForTile(row, col);
+            if (mMovingSlide.count == 0 && mInputQueue.empty() && mBoard.canSlide(slide)) {
+                mDragging = true;
+                mDragSlide = slide;
+                mDragStartX = mDragX = x;
+                mDragStartY = mDragY = y;
+                mDragStartTime = event.button.timestamp;
+            }
+            else
+                queueSlide(slide, event.button.timestamp);
+        }
+        if (mMenuButton.isMouseInside(x, y)) {
+            mMenuButton.changeColourTo(BUTTON_DOWN_COLOUR);
+            mMenuButtonPressed = true;
+        }
+        if (acceptMoves && mHintButton.isMouseInside(x, y)) {
+            mHintButton.changeColourTo(BUTTON_DOWN_COLOUR);
+            mHintSolver.request(mBoard, mHistory);
+            mHintPending = true;
+            mSession.hints++;
+        }
+        if (!mSolved && mAutoButton.isMouseInside(x, y)) {
+            mAutoButton.changeColourTo(BUTTON_DOWN_COLOUR);
+            if (!mAutoSolving) {
+                // Loi giai tinh tu bang da dung yen nen cho tile dang chay xong moi bat dau
+                mAutoSolving = true;
+                mSession.autoSolved = true;
+                mAutoSolveQueued = true;
+                mHintPending = false;
+                mHintSolver.cancel();
+                clearInputQueue();
+            }
+            else
+                mAutoSpeed = (mAutoSpeed + 1) % NUMBER_OF_AUTO_SPEEDS;
+            mAutoButton.setText(AUTO_SPEED_TEXTS[mAutoSpeed]);
+        }
+    }
+    else if (event.type == SDL_MOUSEMOTION && mDragging) {
+        mDragX = event.motion.x;
+        mDragY = event.motion.y;
+    }
+    else if (event.type == SDL_MOUSEBUTTONUP && event.button.button == SDL_BUTTON_LEFT) {
+        if (mDragging) {
+            mDragging = false;
+            mDragX = event.button.x;
+            mDragY = event.button.y;
+            const int distance = dragDistance();
+            if (abs(mDragX - mDragStartX) + abs(mDragY - mDragStartY) <= DRAG_THRESHOLD) {
+                placeDraggedTiles(0);
+                queueSlide(mDragSlide, mDragStartTime);
+            }
+            else if (2 * distance >= dragCellSize()) {
+                // Do tre tinh tu luc tha chuot, thoi gian suy nghi tinh tu luc bat dau keo
+                markSlideInput(event.button.timestamp);
+                recordPlayerSlide(mDragSlide, mDragStartTime);
+                startSlide(mDragSlide, slideTime(mDragSlide) * (dragCellSize() - distance) / dragCellSize());
+                mPlannedBoard.applySlide(mDragSlide);
+            }
+            else
+                placeDraggedTiles(0);
+        }
+        if (!mSolved) {
+            mHintButton.changeColourTo(BUTTON_COLOUR);
+            mAutoButton.changeColourTo(BUTTON_COLOUR);
+        }
+        if (mMenuButtonPressed)
+            mNextScene = SCENE_MENU;
+    }
+}
+
+void PuzzleScene::update(const Uint32 now) {
+    mNow = now;
+    if (mDragging)
+        placeDraggedTiles(dragDistance());
+
+    // Lam cho tile chuyen dong theo thoi gian
+    if (mMovingSlide.count != 0) {
+        TRACE_SCOPE("animation");
+        if (mAnimator.update(mNow))
+            finishSlide();
+    }
+
+    // Lay lan truot cua nguoi choi tu hang doi, hang doi con sau thi di ngay de bat kip nguoi choi
+    Slide queuedSlide;
+    while (!mAutoSolving && mMovingSlide.count == 0 && !mBoard.isSolved() && mInputQueue.pop(queuedSlide)) {
+        Uint32 inputTime = 0;
+        mInputTimes.pop(inputTime);
+        if (!mBoard.canSlide(queuedSlide)) {
+            clearInputQueue();
+            break;
+        }
+        markSlideInput(inputTime);
+        recordPlayerSlide(queuedSlide, inputTime);
+        if (mInputQueue.size() + 1 >= INPUT_INSTANT_DEPTH) {
+            startSlide(queuedSlide, 0);
+            mAnimator.update(mNow);
+            finishSlide();
+        }
+        else
+            startSlide(queuedSlide, slideTime(queuedSlide));
+    }
+    if (mMovingSlide.count == 0 && mBoard.isSolved() && !mInputQueue.empty())
+        clearInputQueue();
+
+    if (mAutoSolveQueued && mMovingSlide.count == 0) {
+        mAutoSolveQueued = false;
+        mAutoSolver.start(mBoard, mHistory);
+    }
+
+    // Tu giai: lay nuoc tiep theo tu hang doi khi tile truoc da dung, luong giai van tiep tuc day nuoc moi vao
+    Slide nextSlide;
+    if (mAutoSolving && mMovingSlide.count == 0 && mSolutionQueue.pop(nextSlide)) {
+        if (mBoard.canSlide(nextSlide)) {
+            const unsigned int speed = AUTO_SPEEDS[mAutoSpeed];
+            startSlide(nextSlide, speed == 0 ? 0 : 1000 / speed);
+            if (speed == 0 && mAnimator.update(mNow))
+                finishSlide();
+        }
+        else {
+            // Cac nuoc tu giai khong di qua mPlannedBoard: dat lai theo bang hien tai
+            mAutoSolving = false;
+            mAutoSolver.stop();
+            mSolutionQueue.clear();
+            clearInputQueue();
+        }
+    }
+
+    if (mCheckSolved) {
+        TRACE_SCOPE("checkSolved");
+        mSolved = paintTiles();
+        mCheckSolved = false;
+        mStaticVersion++;
+
+        // Vua xu ly xong: doi mau cac nut mot lan
+        if (mSolved) {
+            mMenuButton.changeColourTo(TILE_COMPLETION_COLOUR);
+            mMenuButton.changeFontColourTo(FONT_COMPLETION_COLOUR);
+            mHintButton.changeColourTo(TILE_COMPLETION_COLOUR);
+            mHintButton.changeFontColourTo(FONT_COMPLETION_COLOUR);
+            mAutoButton.changeColourTo(TILE_COMPLETION_COLOUR);
+            mAutoButton.changeFontColourTo(FONT_COMPLETION_COLOUR);
+            mAutoButton.setText("Auto");
+            endSession();
+        }
+
+        if (mSolved && mAutoSolving) {
+            mAutoSolving = false;
+            mAutoSolver.stop();
+        }
+    }
+
+    // Goi y chi hien khi khong co tile nao dang chay, mau se tro lai sau nuoc di tiep theo
+    Move hint;
+    if (mHintPending && mMovingSlide.count == 0 && mHintSolver.poll(hint)) {
+        mHintPending = false;
+        mTiles[mBoard.getBlankRow() + MOVE_DELTAS[hint][0]][mBoard.getBlankCol() + MOVE_DELTAS[hint][1]].changeColourTo(HINT_COLOUR);
+        mStaticVersion++;
+    }
+}
+
+void PuzzleScene::publish(FrameSnapshot& snapshot) const {
+    snapshot.scene = SCENE_PUZZLE;
+    snapshot.size = mSize;
+    snapshot.game = mGame;
+    snapshot.solved = mSolved;
+    snapshot.picture = mPictureMode;
+    snapshot.showNumbers = mShowNumbers;
+    snapshot.staticVersion = mStaticVersion;
+    snapshot.inputTime = mSlideInputTime;
+    snapshot.inputSequence = mSlideInputSequence;
+    snapshot.count = 0;
+
+    // Tile dang truot gui kem diem dau, diem dich va thoi gian de luong ve tu noi suy theo thoi diem cua frame
+    for (int row = 0; row < mSize; row++) {
+        for (int col = 0; col < mSize; col++) {
+            const Tile& tile = mTiles[row][col];
+            ElementSnapshot& element = snapshot.elements[snapshot.count++];
+            snapshotElement(element, tile.getNumber(), tile);
+            element.hidden = (&tile == mEmptyTile);
+            element.live = isLiveTile(row, col);
+            element.moving = (mMovingSlide.count != 0 &&
+                              mAnimator.getMotion(&tile, element.from, element.to, element.start, element.duration));
+        }
+    }
+    snapshotElement(snapshot.elements[snapshot.count++], SNAPSHOT_BUTTON_ID, mMenuButton);
+    snapshotElement(snapshot.elements[snapshot.count++], SNAPSHOT_BUTTON_ID + 1, mHintButton);
+    snapshotElement(snapshot.elements[snapshot.count++], SNAPSHOT_BUTTON_ID + 2, mAutoButton);
+}
+
+SceneId PuzzleScene::nextScene() const {
+    return mNextScene;
+}
@@ -0,0 +1,130 @@
+#pragma once
+#include <vector>
+#include <SDL2/SDL.h>
+#include "scene.h"
+#include "tile.h"
+#include "button.h"
+#include "board.h"
+#include "hint.h"
+#include "moveQueue.h"
+#include "ringBuffer.h"
+#include "animator.h"
+#include "autoSolve.h"
+#include "picture.h"
+#include "snapshot.h"
+#include "telemetry.h"
+
+class PuzzleScene : public Scene {
+    // Bang choi cho mot kich thuoc, bo cuc, tile va cac luong giai duoc giu lai giua cac van
+    // Van moi chi dao lai mo hinh bang roi xep lai cac tile da co theo mo hinh do
+    // Tile va nut chi giu vi tri, mau va van ban; PuzzleView tren luong ve so huu moi texture
+    private:
+        const PictureLoader& mPicture;
+        TelemetryWriter& mTelemetry;
+        FrameStats& mFrameStats;
+        const int mSize;
+
+        // Bo cuc
+        const int mScreenWidth;
+        const int mScreenHeight;
+        const int mBorder;
+        const int mTileWidth;
+        const int mTileHeight;
+        const int mTilesTop;
+        const Uint32 mHorizontalSlideTime;
+        const Uint32 mVerticalSlideTime;
+
+        // Giao dien
+        std::vector<std::vector<Tile>> mTiles;
+        Tile* mEmptyTile;
+        Button mMenuButton;
+        Button mHintButton;
+        Button mAutoButton;
+        unsigned int mGame;
+        bool mPictureMode;
+        bool mShowNumbers;
+        // Tang moi khi phan tinh (tile dung yen, nut, nen) doi, luong ve chi ve lai backdrop khi no doi
+        unsigned int mStaticVersion;
+
+        // Mo hinh va cac luong giai
+        Board mBoard;
+        std::vector<Move> mHistory;
+        HintSolver mHintSolver;
+        bool mHintPending;
+        unsigned int mAutoSpeed;
+        bool mAutoSolving;
+        bool mAutoSolveQueued;
+        MoveQueue mSolutionQueue;
+        AutoSolver mAutoSolver;
+
+        // Nuoc di cua nguoi choi va animation
+        MoveQueue mInputQueue;
+        // Thoi diem (SDL_GetTicks) cua su kien sinh ra tung lan truot trong hang doi, cung thu tu voi hang doi
+        RingBuffer<Uint32> mInputTimes;
+        // Thoi diem input va so thu tu cua lan truot cua nguoi choi gan nhat da bat dau chay, 0 neu chua co
+        Uint32 mSlideInputTime;
+        unsigned int mSlideInputSequence;
+        Board mPlannedBoard;
+        SlideAnimator mAnimator;
+        // Thoi gian mo phong cua lan cap nhat gan nhat (ms)
+        Uint32 mNow;
+        Slide mMovingSlide;
+        bool mDragging;
+        Slide mDragSlide;
+        int mDragStartX, mDragStartY;
+        int mDragX, mDragY;
+        Uint32 mDragStartTime;
+
+        // Ban ghi cua van dang choi, gui cho TelemetryWriter khi xep xong hoac roi bang choi
+        SessionRecord mSession;
+        bool mSessionOpen;
+        Uint32 mSessionStart;
+        Uint32 mLastInputTime;
+
+        bool mCheckSolved;
+        bool mSolved;
+        bool mMenuButtonPressed;
+        SceneId mNextScene;
+
+        SDL_Rect buttonRect(const int index) const;
+        int tileX(const int col) const;
+        int tileY(const int row) const;
+        Uint32 slideTime(const Slide& slide) const;
+
+        void paintTile(Tile& tile, const SDL_Color& colour, const SDL_Color& fontColour);
+        bool paintTiles();
+
+        // Lan truot cua nguoi choi bat dau chay: ghi lai input de luong ve do do tre
+        void markSlideInput(const Uint32 inputTime);
+        void recordPlayerSlide(const Slide& slide, const Uint32 inputTime);
+        void endSession();
+        void queueSlide(const Slide& slide, const Uint32 timestamp);
+        void clearInputQueue();
+        void startSlide(const Slide& slide, const Uint32 duration);
+        void finishSlide();
+        int dragCellSize() const;
+        int dragDistance() const;
+        void placeDraggedTiles(const int distance);
+        bool isLiveTile(const int row, const int col) const;
+
+    public:
+        PuzzleScene(const PictureLoader& picture, TelemetryWriter& telemetry, FrameStats& frameStats, const int size,
+                    const unsigned int SCREEN_WIDTH, const unsigned int SCREEN_HEIGHT);
+        ~PuzzleScene();
+
+        // Dao lai bang tu seed va bat dau van moi, khong tao lai tile da co
+        // Cung seed cho cung bang tren moi nen tang (xem Random)
+        void newGame(const unsigned int tileMode, const unsigned int seed);
+
+        void leave() override;
+        void handleEvent(const SDL_Event& event) override;
+        void update(const Uint32 now) override;
+        void publish(FrameSnapshot& snapshot) const override;
+        SceneId nextScene() const override;
+
+        // O (row, col) chua diem (x, y) tren man hinh, false neu diem nam ngoai bang hoac tren vien
+        bool cellAt(const int x, const int y, int& row, int& col) const;
+        // Diem giua cua o (row, col) va vung cua nut goi y, de gui input gia khi kiem tra
+        SDL_Point cellCentre(const int row, const int col) const;
+        const SDL_Rect& getHintButtonRect() const;
+};
@@ -0,0 +1,193 @@
+#include <iostream>
+#include <string.h>
+#include "puzzleView.h"
+#include "layout.h"
+
+using namespace std;
+
+// Mau cua dong ho
+const SDL_Color STOPWATCH_COLOUR = {255, 0, 0, 255}; // Red
+const SDL_Color STOPWATCH_FONT_COLOUR = {0, 0, 0, 255}; // Black
+
+static const ElementSnapshot* findElement(const FrameSnapshot& snapshot, const int id) {
+    for (int i = 0; i < snapshot.count; i++) {
+        if (snapshot.elements[i].id == id)
+            return &snapshot.elements[i];
+    }
+    return nullptr;
+}
+
+PuzzleView::PuzzleView(SDL_Renderer* const renderer, ResourceManager& resources, PictureLoader& picture,
+                       const FrameSnapshot& snapshot, const int SCREEN_WIDTH, const int SCREEN_HEIGHT,
+                       const bool useBackdrop)
+    : mRenderer(renderer), mPicture(picture), mSize(snapshot.size),
+      mScreenWidth(SCREEN_WIDTH), mScreenHeight(SCREEN_HEIGHT), mBorder(PUZZLE_BORDER_THICKNESS),
+      mTileWidth(puzzleTileWidth(mSize, SCREEN_WIDTH)), mTileHeight(puzzleTileHeight(mSize, SCREEN_HEIGHT)),
+      mTileFace(resources.getFace(FONT_FILE, tileFontSize(mTileHeight))),
+      mStopwatchFace(resources.getFace(FONT_FILE, stopwatchFontSize(mTileHeight))),
+      mButtonFace(resources.getFace(FONT_FILE, buttonFontSize(mTileHeight))),
+      mHidden(-1),
+      mStopwatch({mBorder, mBorder, mScreenWidth - 2 * mBorder, mTileHeight}, STOPWATCH_COLOUR,
+                 mStopwatchFace.font, STOPWATCH_FONT_COLOUR),
+      mTileTexturesLoaded(false), mPictureTexture(nullptr), mShowNumbers(true), mNumbers(nullptr),
+      mBackdrop(nullptr), mBackdropDirty(true), mStaticVersion(0), mGame(0), mSolved(false),
+      mRenderTime(0) {
+
+    // Moi tile ve vung cua o dich cua no trong anh o che do xep hinh
+    mTiles.reserve(mSize * mSize);
+    for (int number = 1; number <= mSize * mSize; number++) {
+        const ElementSnapshot* element = findElement(snapshot, number);
+        const int row = (number - 1) / mSize;
+        const int col = (number - 1) % mSize;
+        mTiles.emplace_back(element->rect, element->colour, mTileFace.font, element->fontColour, number);
+        Tile& tile = mTiles.back();
+        tile.setText(element->text);
+        tile.setGlyphAtlas(mTileFace.atlas);
+        tile.setPictureRect({col * (mTileWidth + mBorder), row * (mTileHeight + mBorder), mTileWidth, mTileHeight});
+    }
+    mLive.assign(mTiles.size(), false);
+
+    mButtons.reserve(snapshot.count - mTiles.size());
+    for (int id = SNAPSHOT_BUTTON_ID; findElement(snapshot, id) != nullptr; id++) {
+        const ElementSnapshot* element = findElement(snapshot, id);
+        mButtons.emplace_back(element->rect, element->colour, mButtonFace.font, element->fontColour);
+        mButtons.back().setGlyphAtlas(mButtonFace.atlas);
+        mButtons.back().loadTexture(renderer, element->text);
+    }
+    if (mStopwatchFace.atlas != nullptr)
+        mStopwatch.setGlyphAtlas(mStopwatchFace.atlas);
+    else if (mStopwatchAtlas.load(renderer, mStopwatchFace.font, STOPWATCH_GLYPHS))
+        mStopwatch.setGlyphAtlas(&mStopwatchAtlas);
+
+    // Backdrop: anh cua nen, cac tile dung yen va cac nut, chi ve lai khi co tile dung lai hoac doi mau
+    // Khong ho tro render target (hoac useBackdrop = false de so sanh) thi ve truc tiep nhu cu
+    if (useBackdrop && SDL_RenderTargetSupported(renderer)) {
+        mBackdrop = TRACK_TEXTURE(SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                                   mScreenWidth, mScreenHeight));
+        if (mBackdrop == nullptr)
+            cout << "Unable to create backdrop texture! Error: " << SDL_GetError() << endl;
+        else
+            // Mot so mau co alpha = 0, copy khong tron de giong nhu khi ve truc tiep
+            SDL_SetTextureBlendMode(mBackdrop, SDL_BLENDMODE_NONE);
+    }
+}
+
+PuzzleView::~PuzzleView() {
+    // Texture cua tile, nut va dong ho tu huy cung doi tuong, chi con atlas va backdrop
+    mStopwatchAtlas.free();
+    destroyTexture(mBackdrop);
+    mNumberAtlas.free();
+}
+
+void PuzzleView::startGame(const FrameSnapshot& snapshot) {
+    // Texture so cua tile va glyph atlas chi tao lan dau can den, co font ve san thi dung luon atlas cua no
+    mGame = snapshot.game;
+    mPictureTexture = nullptr;
+    if (snapshot.picture)
+        mPictureTexture = mPicture.getTexture(mRenderer, mSize * mTileWidth + (mSize - 1) * mBorder,
+                                              mSize * mTileHeight + (mSize - 1) * mBorder);
+    mShowNumbers = (mPictureTexture == nullptr || snapshot.showNumbers);
+    if (mPictureTexture == nullptr && !mTileTexturesLoaded) {
+        for (auto& tile : mTiles)
+            tile.loadTexture(mRenderer, tile.getText());
+        mTileTexturesLoaded = true;
+    }
+    if (mTileFace.atlas != nullptr)
+        mNumbers = mTileFace.atlas;
+    else if (mPictureTexture != nullptr && mShowNumbers && mNumbers == nullptr && mNumberAtlas.load(mRenderer, mTileFace.font, TILE_GLYPHS))
+        mNumbers = &mNumberAtlas;
+
+    mBackdropDirty = true;
+    mStopwatch.start(snapshot.simTime);
+}
+
+void PuzzleView::apply(const FrameSnapshot& snapshot, const Uint32 renderTime) {
+    if (snapshot.game != mGame)
+        startGame(snapshot);
+    if (snapshot.staticVersion != mStaticVersion) {
+        mStaticVersion = snapshot.staticVersion;
+        mBackdropDirty = true;
+    }
+    mSolved = snapshot.solved;
+    mRenderTime = renderTime;
+
+    mHidden = -1;
+    for (int i = 0; i < snapshot.count; i++) {
+        const ElementSnapshot& element = snapshot.elements[i];
+        if (element.id >= SNAPSHOT_BUTTON_ID) {
+            Button& button = mButtons[element.id - SNAPSHOT_BUTTON_ID];
+            button.changeColourTo(element.colour);
+            if (button.changeFontColourTo(element.fontColour) || strcmp(button.getText(), element.text) != 0)
+                button.loadTexture(mRenderer, element.text);
+            continue;
+        }
+
+        // Chi ve lai chu khi mau chu thuc su doi
+        const int index = element.id - 1;
+        Tile& tile = mTiles[index];
+        tile.changeColourTo(element.colour);
+        if (tile.changeFontColourTo(element.fontColour) && mTileTexturesLoaded)
+            tile.loadTexture(mRenderer, tile.getText());
+
+        // Tile dang truot duoc dat theo thoi diem cua frame nay de chuyen dong muot o moi toc do ve
+        if (element.moving) {
+            const Uint32 elapsed = (renderTime > element.start) ? renderTime - element.start : 0;
+            const float progress = (elapsed >= element.duration) ? 1.0f : (float)elapsed / element.duration;
+            tile.setPositionTo(element.from.x + (int)((element.to.x - element.from.x) * progress),
+                               element.from.y + (int)((element.to.y - element.from.y) * progress));
+        }
+        else
+            tile.setPositionTo(element.rect.x, element.rect.y);
+        mLive[index] = element.live;
+        if (element.hidden)
+            mHidden = index;
+    }
+}
+
+void PuzzleView::renderTile(const Tile& tile) const {
+    // O che do xep hinh tile khong dung texture rieng, so lay tu glyph atlas
+    if (mPictureTexture != nullptr)
+        tile.renderPicture(mRenderer, mPictureTexture, mShowNumbers ? mNumbers : nullptr);
+    else
+        tile.render(mRenderer);
+}
+
+void PuzzleView::render() {
+    // Ve lai phan tinh vao backdrop khi can, moi frame chi copy backdrop roi ve dong ho va cac tile dang chay
+    if (mBackdropDirty || mBackdrop == nullptr) {
+        if (mBackdrop != nullptr)
+            SDL_SetRenderTarget(mRenderer, mBackdrop);
+
+        if (mSolved)
+            SDL_SetRenderDrawColor(mRenderer, 14, 87, 29, 255);
+        else
+            SDL_SetRenderDrawColor(mRenderer, 0, 0, 0, 255);
+
+        SDL_RenderClear(mRenderer);
+
+        for (size_t i = 0; i < mTiles.size(); i++) {
+            if ((int)i != mHidden && (mBackdrop == nullptr || !mLive[i]))
+                renderTile(mTiles[i]);
+        }
+
+        for (const auto& button : mButtons)
+            button.render(mRenderer);
+
+        if (mBackdrop != nullptr) {
+            SDL_SetRenderTarget(mRenderer, nullptr);
+            mBackdropDirty = false;
+        }
+    }
+
+    if (mBackdrop != nullptr) {
+        SDL_RenderCopy(mRenderer, mBackdrop, nullptr, nullptr);
+        for (size_t i = 0; i < mTiles.size(); i++) {
+            if (mLive[i])
+                renderTile(mTiles[i]);
+        }
+    }
+
+    // Neu xu ly xong thi stopwatch dung lai
+    mStopwatch.calculateTime(mRenderer, mSolved, mRenderTime);
+    mStopwatch.render(mRenderer);
+}
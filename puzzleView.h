@@ -0,0 +1,59 @@
+#pragma once
+#include <vector>
+#include <SDL2/SDL.h>
+#include "sceneView.h"
+#include "tile.h"
+#include "button.h"
+#include "stopwatch.h"
+#include "glyphAtlas.h"
+#include "picture.h"
+#include "resources.h"
+
+class PuzzleView : public SceneView {
+    // Ve bang choi cua mot kich thuoc tren luong ve: tile, nut, dong ho, anh va backdrop
+    // Tile luu theo so (mTiles[so - 1]), vi tri va mau lay tu snapshot moi frame
+    // Chu chi tao lai khi van ban hoac mau chu doi, backdrop chi ve lai khi staticVersion doi
+    private:
+        SDL_Renderer* mRenderer;
+        PictureLoader& mPicture;
+        const int mSize;
+        const int mScreenWidth;
+        const int mScreenHeight;
+        const int mBorder;
+        const int mTileWidth;
+        const int mTileHeight;
+
+        TextFace mTileFace;
+        TextFace mStopwatchFace;
+        TextFace mButtonFace;
+        std::vector<Tile> mTiles;
+        std::vector<bool> mLive;
+        int mHidden;
+        std::vector<Button> mButtons;
+        Stopwatch mStopwatch;
+        // Khong co font ve san thi dong ho ve tu atlas rieng, doi giay khong phai tao texture moi
+        GlyphAtlas mStopwatchAtlas;
+        bool mTileTexturesLoaded;
+        SDL_Texture* mPictureTexture;
+        bool mShowNumbers;
+        GlyphAtlas mNumberAtlas;
+        const GlyphAtlas* mNumbers;
+        SDL_Texture* mBackdrop;
+        bool mBackdropDirty;
+        unsigned int mStaticVersion;
+        unsigned int mGame;
+        bool mSolved;
+        Uint32 mRenderTime;
+
+        void startGame(const FrameSnapshot& snapshot);
+        void renderTile(const Tile& tile) const;
+
+    public:
+        PuzzleView(SDL_Renderer* const renderer, ResourceManager& resources, PictureLoader& picture,
+                   const FrameSnapshot& snapshot, const int SCREEN_WIDTH, const int SCREEN_HEIGHT,
+                   const bool useBackdrop = true);
+        ~PuzzleView();
+
+        void apply(const FrameSnapshot& snapshot, const Uint32 renderTime) override;
+        void render() override;
+};
@@ -0,0 +1,29 @@
+#pragma once
+#include <stdint.h>
+
+class Random {
+    // Bo sinh so gia ngau nhien xorshift64* (Vigna): cung seed cho cung day so tren moi nen tang va moi libc,
+    // khong nhu rand() nen bang dao va kich ban kiem tra dung lai duoc o bat cu dau
+    private:
+        uint64_t mState;
+
+    public:
+        Random(const uint64_t seed)
+            : mState(seed * 0x9E3779B97F4A7C15ULL + 1) {
+            // Trang thai khong duoc bang 0; nhan voi hang so vang trai deu cac seed nho
+            if (mState == 0)
+                mState = 1;
+        }
+
+        uint32_t next() {
+            mState ^= mState >> 12;
+            mState ^= mState << 25;
+            mState ^= mState >> 27;
+            return (uint32_t)((mState * 0x2545F4914F6CDD1DULL) >> 32);
+        }
+
+        // So nguyen trong [0, bound), bound > 0
+        int below(const int bound) {
+            return (int)(next() % (uint32_t)bound);
+        }
+};
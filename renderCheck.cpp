@@ -0,0 +1,272 @@
+// Kiem tra duong ve khong can man hinh hay GPU: renderer phan mem ve vao surface trong bo nho
+// Moi kich thuoc bang, moi cach ve tile (so, anh tu ve, anh + so) va moi cach ve choi cung mot chuoi nuoc co dinh,
+// do FPS va bam pixel cua moi frame. Bang va chuoi phim sinh bang Random nen giong nhau tren moi nen tang
+// Cac cach ve (backdrop/truc tiep) phai cho cung checksum, khac nhau la that bai o moi nen tang
+// Pixel con phu thuoc bo blit cua SDL, FreeType da ve font (fontAtlasData.h) va co gian anh, nen checksum trong
+// renderGolden.txt ghi theo bo cong cu: nen tang, phien ban SDL va checksum font, vd. "Linux-SDL2.28.4-baked-1234abcd"
+// Bo cong cu da co checksum thi lan chay nao thieu checksum cung tinh la that bai; bo cong cu chua co checksum nao
+// chi so sanh cac cach ve voi nhau va nhac chay --update-golden (make rendergolden) roi commit renderGolden.txt
+// Tham so: [--golden file] [--update-golden]
+#include <stdio.h>
+#include <stdint.h>
+#include <SDL2/SDL_ttf.h>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include "frontend.cpp"
+
+using namespace std;
+
+const string GOLDEN_FILE = "renderGolden.txt";
+
+// Kich ban: seed cua bang va cua chuoi phim, moi phim cach nhau vai buoc mo phong,
+// sau phim cuoi chay them cho tile dung yen. Anh kiem tra la day vach mau tinh tu toa do pixel
+const unsigned int SCRIPT_SEED = 4242;
+const int SCRIPT_MOVES = 40;
+const int STEPS_PER_MOVE = 6;
+const int SETTLE_STEPS = 120;
+const SDL_Keycode SCRIPT_KEYS[4] = {SDLK_UP, SDLK_DOWN, SDLK_LEFT, SDLK_RIGHT};
+const int PICTURE_WIDTH = 256;
+const int PICTURE_HEIGHT = 256;
+const int PICTURE_STRIPE = 32;
+
+const uint64_t FNV_OFFSET = 14695981039346656037ULL;
+const uint64_t FNV_PRIME = 1099511628211ULL;
+
+// Cac cach ve cung phai cho ra cung mot hinh
+struct RenderStrategy {
+    const char* name;
+    bool useBackdrop;
+};
+const RenderStrategy RENDER_STRATEGIES[] = {{"backdrop", true}, {"direct", false}};
+// Ten cach ve tile trong checksum, theo thu tu TILE_MODE_*
+const char* const TILE_MODE_NAMES[NUMBER_OF_TILE_MODES] = {"numbers", "picture", "picture+numbers"};
+
+struct RenderRun {
+    int frames;
+    double seconds;
+    uint64_t hash;
+};
+
+// Nhung thu ma moi lan chay kich ban dung chung
+struct RenderHarness {
+    SDL_Surface* surface;
+    SDL_Renderer* renderer;
+    ResourceManager resources;
+    PictureLoader picture;
+    TelemetryWriter telemetry;
+    FrameStats frameStats;
+    FrameSnapshot snapshot;
+
+    RenderHarness() : surface(nullptr), renderer(nullptr), telemetry("") {}
+};
+
+static uint64_t hashPixels(uint64_t hash, const SDL_Surface* surface) {
+    // FNV-1a tren tung dong pixel, bo phan dem o cuoi dong
+    const uint8_t* row = (const uint8_t*)surface->pixels;
+    const int bytes = surface->w * surface->format->BytesPerPixel;
+    for (int y = 0; y < surface->h; y++, row += surface->pitch) {
+        for (int x = 0; x < bytes; x++) {
+            hash ^= row[x];
+            hash *= FNV_PRIME;
+        }
+    }
+    return hash;
+}
+
+static SDL_Surface* createTestPicture() {
+    // Vach cheo nhieu mau, moi o cua bang lay mot vung khac nhau nen tile dat sai cho doi checksum
+    SDL_Surface* picture = SDL_CreateRGBSurfaceWithFormat(0, PICTURE_WIDTH, PICTURE_HEIGHT, 32, SDL_PIXELFORMAT_RGBA32);
+    if (picture == nullptr)
+        return nullptr;
+    for (int y = 0; y < PICTURE_HEIGHT; y++) {
+        Uint8* row = (Uint8*)picture->pixels + y * picture->pitch;
+        for (int x = 0; x < PICTURE_WIDTH; x++) {
+            const int stripe = (x + y) / PICTURE_STRIPE;
+            row[4 * x] = (Uint8)(x * 255 / PICTURE_WIDTH);
+            row[4 * x + 1] = (Uint8)(y * 255 / PICTURE_HEIGHT);
+            row[4 * x + 2] = (Uint8)(stripe % 2 == 0 ? 200 : 40);
+            row[4 * x + 3] = 255;
+        }
+    }
+    return picture;
+}
+
+static string toolchainName(const bool bakedFont) {
+    // Nhung thu quyet dinh pixel ngoai ma nguon cua game
+    SDL_version sdl;
+    SDL_GetVersion(&sdl);
+    char name[96];
+    if (bakedFont)
+        snprintf(name, sizeof(name), "%s-SDL%d.%d.%d-baked-%08x", SDL_GetPlatform(), sdl.major, sdl.minor, sdl.patch,
+                 (unsigned int)BakedFont::checksum());
+    else {
+        const SDL_version* ttf = TTF_Linked_Version();
+        snprintf(name, sizeof(name), "%s-SDL%d.%d.%d-ttf%d.%d.%d", SDL_GetPlatform(), sdl.major, sdl.minor, sdl.patch,
+                 ttf->major, ttf->minor, ttf->patch);
+    }
+    return name;
+}
+
+static RenderRun runScript(RenderHarness& harness, const int size, const unsigned int tileMode,
+                           const RenderStrategy& strategy) {
+    // Cung seed nen moi cach ve thay cung bang va cung chuoi phim; thoi gian mo phong tang deu moi buoc
+    // nen dong ho va vi tri tile cua moi frame khong phu thuoc toc do may. Chi tinh thoi gian ve, khong tinh bam
+    Random script(SCRIPT_SEED);
+    PuzzleScene scene(harness.picture, harness.telemetry, harness.frameStats, size, SCREEN_WIDTH, SCREEN_HEIGHT);
+    scene.newGame(tileMode, SCRIPT_SEED);
+    const Uint32 stepTime = 1000 / UPDATES_PER_SECOND;
+    Uint32 now = 0;
+    scene.publish(harness.snapshot);
+    harness.snapshot.simTime = now;
+    PuzzleView view(harness.renderer, harness.resources, harness.picture, harness.snapshot, SCREEN_WIDTH, SCREEN_HEIGHT,
+                    strategy.useBackdrop);
+
+    RenderRun run = {0, 0, FNV_OFFSET};
+    Uint64 renderTicks = 0;
+    for (int step = 0; step < SCRIPT_MOVES * STEPS_PER_MOVE + SETTLE_STEPS; step++) {
+        if (step % STEPS_PER_MOVE == 0 && step / STEPS_PER_MOVE < SCRIPT_MOVES) {
+            SDL_Event key = {};
+            key.type = SDL_KEYDOWN;
+            key.key.keysym.sym = SCRIPT_KEYS[script.below(4)];
+            scene.handleEvent(key);
+        }
+        now += stepTime;
+        scene.update(now);
+        scene.publish(harness.snapshot);
+        harness.snapshot.simTime = now;
+
+        const Uint64 start = SDL_GetPerformanceCounter();
+        view.apply(harness.snapshot, now);
+        view.render();
+        SDL_RenderPresent(harness.renderer);
+        renderTicks += SDL_GetPerformanceCounter() - start;
+        run.frames++;
+        run.hash = hashPixels(run.hash, harness.surface);
+    }
+    run.seconds = (double)renderTicks / SDL_GetPerformanceFrequency();
+    return run;
+}
+
+static void readGolden(const string& path, map<string, uint64_t>& golden) {
+    // Moi dong: ten checksum (hex)
+    ifstream input(path);
+    string name, hash;
+    while (input >> name >> hash)
+        golden[name] = strtoull(hash.c_str(), nullptr, 16);
+}
+
+static bool writeGolden(const string& path, const map<string, uint64_t>& golden) {
+    ofstream output(path);
+    if (!output) {
+        cout << "Unable to write " << path << endl;
+        return false;
+    }
+    char hash[17];
+    for (const auto& entry : golden) {
+        snprintf(hash, sizeof(hash), "%016llx", (unsigned long long)entry.second);
+        output << entry.first << " " << hash << "\n";
+    }
+    return true;
+}
+
+int main(int argc, char* args[]) {
+    string goldenFile = GOLDEN_FILE;
+    bool updateGolden = false;
+    for (int i = 1; i < argc; i++) {
+        const string arg = args[i];
+        if (arg == "--golden" && i + 1 < argc)
+            goldenFile = args[++i];
+        else if (arg == "--update-golden")
+            updateGolden = true;
+        else {
+            cout << "Usage: renderCheck [--golden file] [--update-golden]" << endl;
+            return 1;
+        }
+    }
+    map<string, uint64_t> golden;
+    readGolden(goldenFile, golden);
+
+    unique_ptr<RenderHarness> harness(new RenderHarness());
+    harness->surface = SDL_CreateRGBSurfaceWithFormat(0, SCREEN_WIDTH, SCREEN_HEIGHT, 32, SDL_PIXELFORMAT_RGBA8888);
+    if (harness->surface == nullptr) {
+        cout << "Unable to create render surface! Error: " << SDL_GetError() << endl;
+        return 1;
+    }
+    harness->renderer = SDL_CreateSoftwareRenderer(harness->surface);
+    if (harness->renderer == nullptr) {
+        cout << "Unable to create software renderer! Error: " << SDL_GetError() << endl;
+        return 1;
+    }
+    SDL_Surface* picture = createTestPicture();
+    if (picture == nullptr) {
+        cout << "Unable to create test picture! Error: " << SDL_GetError() << endl;
+        return 1;
+    }
+    harness->picture.use(picture);
+
+    // Checksum cua bo cong cu khac khong dung duoc o day, xem dau file
+    const string toolchain = toolchainName(harness->resources.loadBakedFont(harness->renderer));
+    const string prefix = toolchain + ":";
+    const auto recorded = golden.lower_bound(prefix);
+    const bool hasGolden = recorded != golden.end() && recorded->first.compare(0, prefix.size(), prefix) == 0;
+    cout << "Toolchain " << toolchain << endl;
+
+    int mismatches = 0;
+    int missing = 0;
+    int disagreements = 0;
+    for (unsigned int tileMode = 0; tileMode < NUMBER_OF_TILE_MODES; tileMode++) {
+        for (unsigned int size = MIN_DIFFICULTY; size <= MAX_DIFFICULTY; size++) {
+            uint64_t firstHash = 0;
+            for (const RenderStrategy& strategy : RENDER_STRATEGIES) {
+                const RenderRun run = runScript(*harness, size, tileMode, strategy);
+                const string name = prefix + to_string(size) + "x" + to_string(size) + "/" + TILE_MODE_NAMES[tileMode] +
+                                    "/" + strategy.name;
+                char hash[17];
+                snprintf(hash, sizeof(hash), "%016llx", (unsigned long long)run.hash);
+                cout << name << ": " << run.frames << " frames, " << run.frames / run.seconds << " fps, hash " << hash;
+
+                const auto found = golden.find(name);
+                if (updateGolden)
+                    golden[name] = run.hash;
+                else if (hasGolden && found == golden.end()) {
+                    cout << " NO GOLDEN";
+                    missing++;
+                }
+                else if (found != golden.end() && found->second != run.hash) {
+                    cout << " MISMATCH";
+                    mismatches++;
+                }
+                if (&strategy != RENDER_STRATEGIES && run.hash != firstHash) {
+                    cout << " DIFFERS from " << RENDER_STRATEGIES[0].name;
+                    disagreements++;
+                }
+                else
+                    firstHash = run.hash;
+                cout << endl;
+            }
+        }
+    }
+
+    bool written = true;
+    if (updateGolden)
+        written = writeGolden(goldenFile, golden);
+    else {
+        if (!hasGolden)
+            cout << "No goldens recorded for " << toolchain << ", only compared render strategies; "
+                 << "record them with make rendergolden" << endl;
+        cout << mismatches << " mismatch(es), " << missing << " without golden, " << disagreements
+             << " strategy disagreement(s)" << endl;
+    }
+
+    harness->picture.free();
+    harness->resources.free();
+    SDL_DestroyRenderer(harness->renderer);
+    SDL_FreeSurface(harness->surface);
+    harness.reset();
+    if (TTF_WasInit())
+        TTF_Quit();
+    SDL_Quit();
+    return (written && mismatches == 0 && missing == 0 && disagreements == 0) ? 0 : 1;
+}
@@ -0,0 +1,159 @@
+#include <iostream>
+#include "renderThread.h"
+#include "SDL_utils.h"
+#include "trace.h"
+
+using namespace std;
+
+RenderThread::RenderThread(SDL_Window* const window, TripleBuffer<FrameSnapshot>& snapshots, ResourceManager& resources,
+                           PictureLoader& picture, StartupProfile& startup, LatencyHistogram& latency,
+                           FrameStats& frameStats, const FrameConfig& config, const int SCREEN_WIDTH, const int SCREEN_HEIGHT)
+    : mWindow(window), mSnapshots(snapshots), mResources(resources), mPicture(picture), mStartup(startup),
+      mLatency(latency), mFrameStats(frameStats), mConfig(config), mScreenWidth(SCREEN_WIDTH), mScreenHeight(SCREEN_HEIGHT),
+      mStop(false), mPresented(false), mFrames(0), mAllocations("render"), mRenderer(nullptr) {
+}
+
+RenderThread::~RenderThread() {
+    stop();
+}
+
+void RenderThread::start() {
+    mStop = false;
+    mThread = thread(&RenderThread::run, this);
+}
+
+void RenderThread::stop() {
+    mStop = true;
+    if (mThread.joinable())
+        mThread.join();
+}
+
+bool RenderThread::hasPresented() const {
+    return mPresented.load(memory_order_acquire);
+}
+
+uint64_t RenderThread::getFrameCount() const {
+    return mFrames.load(memory_order_acquire);
+}
+
+const FrameAllocations& RenderThread::getAllocations() const {
+    return mAllocations;
+}
+
+SceneView* RenderThread::viewFor(const FrameSnapshot& snapshot) {
+    // View cua moi scene tao lan dau thay scene do trong snapshot va giu den khi thoat
+    if (snapshot.scene == SCENE_MENU) {
+        if (!mMenu)
+            mMenu.reset(new MenuView(mRenderer, mResources, snapshot));
+        return mMenu.get();
+    }
+    if (snapshot.scene == SCENE_PUZZLE) {
+        unique_ptr<PuzzleView>& puzzle = mPuzzles[snapshot.size - MIN_DIFFICULTY];
+        if (!puzzle)
+            puzzle.reset(new PuzzleView(mRenderer, mResources, mPicture, snapshot, mScreenWidth, mScreenHeight));
+        return puzzle.get();
+    }
+    return nullptr;
+}
+
+static void waitUntil(const Uint64 deadline, const Uint64 frequency) {
+    // Ngu phan lon thoi gian, ms cuoi cung quay vong de dung moc ma khong phu thuoc do phan giai cua SDL_Delay
+    const Uint64 now = SDL_GetPerformanceCounter();
+    if (now >= deadline)
+        return;
+    const Uint32 milliSeconds = (Uint32)((deadline - now) * 1000 / frequency);
+    if (milliSeconds > 1)
+        SDL_Delay(milliSeconds - 1);
+    while (SDL_GetPerformanceCounter() < deadline) {
+    }
+}
+
+void RenderThread::run() {
+    traceThreadName("render");
+    mRenderer = createRenderer(mWindow, mScreenWidth, mScreenHeight, mConfig.vsync);
+    mStartup.mark("renderer");
+
+    // Font ve san luc build chi can tai len mot texture, khong co thi mo font TTF tren luong rieng ngay luc khoi dong
+    // de van dau tien khong phai cho dia hay FreeType
+    if (!mResources.loadBakedFont(mRenderer))
+        mResources.preload(fontsToPreload(mScreenHeight));
+    mStartup.mark("fonts");
+
+    // Toc do ve do vsync va/hoac config.fps quyet dinh, doc lap voi toc do mo phong
+    const Uint64 frequency = SDL_GetPerformanceFrequency();
+    const Uint64 frameTicks = (mConfig.fps > 0) ? frequency / mConfig.fps : 0;
+    const Uint32 stepTime = 1000 / UPDATES_PER_SECOND;
+    const Uint64 startTime = SDL_GetPerformanceCounter();
+    Uint64 nextFrame = startTime;
+    Uint64 lastPresent = 0;
+    Uint64 frames = 0;
+    unsigned int lastInputSequence = 0;
+
+    while (!mStop.load(memory_order_acquire)) {
+        mAllocations.beginFrame();
+        mSnapshots.fetch();
+        const FrameSnapshot& snapshot = mSnapshots.front();
+        SceneView* view = viewFor(snapshot);
+        if (view != nullptr) {
+            // Thoi gian mo phong cua frame nay: luc publish cong thoi gian da troi qua,
+            // khong doan truoc qua mot buoc de tile dung cho khi luong mo phong bi cham
+            Uint32 ahead = (Uint32)((SDL_GetPerformanceCounter() - snapshot.publishedAt) * 1000 / frequency);
+            if (ahead > stepTime)
+                ahead = stepTime;
+            TRACE_SCOPE("render");
+            view->apply(snapshot, snapshot.simTime + ahead);
+            view->render();
+        }
+        else {
+            // Chua co snapshot nao
+            SDL_SetRenderDrawColor(mRenderer, 0, 0, 0, 255);
+            SDL_RenderClear(mRenderer);
+        }
+        {
+            TRACE_SCOPE("present");
+            SDL_RenderPresent(mRenderer);
+        }
+        frames++;
+        mFrames.store(frames, memory_order_release);
+        const Uint64 presented = SDL_GetPerformanceCounter();
+        if (lastPresent != 0)
+            mFrameStats.record((presented - lastPresent) * 1000000 / frequency);
+        lastPresent = presented;
+
+        // Lan dau hien tile cua lan truot moi: do tu timestamp cua su kien den luc present xong
+        if (snapshot.inputSequence != 0 && snapshot.inputSequence != lastInputSequence) {
+            mLatency.record(SDL_GetTicks() - snapshot.inputTime);
+            lastInputSequence = snapshot.inputSequence;
+        }
+        mAllocations.endFrame();
+
+        // Frame dau tien da hien: ket thuc do thoi gian khoi dong, luong chinh se khoi tao tay cam
+        if (!mStartup.isFinished()) {
+            mStartup.finish();
+            mPresented.store(true, memory_order_release);
+        }
+
+        // Gioi han FPS, tre hon mot frame thi tinh lai moc tu bay gio
+        if (frameTicks != 0) {
+            nextFrame += frameTicks;
+            const Uint64 now = SDL_GetPerformanceCounter();
+            if (now > nextFrame + frameTicks)
+                nextFrame = now;
+            waitUntil(nextFrame, frequency);
+        }
+    }
+
+    if (mConfig.uncapped) {
+        const double seconds = (double)(SDL_GetPerformanceCounter() - startTime) / frequency;
+        cout << "Rendered " << frames << " frames in " << seconds << " s (" << frames / seconds << " fps)" << endl;
+    }
+
+    // Moi texture phai duoc huy truoc renderer va tren luong cua no
+    mMenu.reset();
+    for (auto& puzzle : mPuzzles)
+        puzzle.reset();
+    mPicture.free();
+    mResources.free();
+    SDL_DestroyRenderer(mRenderer);
+    mRenderer = nullptr;
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <thread>
+#include <atomic>
+#include <memory>
+#include <SDL2/SDL.h>
+#include "tripleBuffer.h"
+#include "snapshot.h"
+#include "menuView.h"
+#include "puzzleView.h"
+#include "picture.h"
+#include "resources.h"
+#include "startupProfile.h"
+#include "latency.h"
+#include "telemetry.h"
+#include "allocCount.h"
+#include "timing.h"
+#include "layout.h"
+
+class RenderThread {
+    // Luong ve: tao va so huu SDL_Renderer, moi lenh ve va moi texture chi duoc goi tren luong nay
+    // Moi frame lay snapshot moi nhat tu bo dem ba (khong khoa) nen khong bao gio cho luong mo phong,
+    // luong mo phong cung khong phai cho vsync hay viec tai texture
+    // Cac view, anh va font duoc giai phong tren luong nay truoc khi huy renderer
+    // Do tre input den man hinh: lan present dau tien cua snapshot co inputSequence moi
+    private:
+        SDL_Window* mWindow;
+        TripleBuffer<FrameSnapshot>& mSnapshots;
+        ResourceManager& mResources;
+        PictureLoader& mPicture;
+        StartupProfile& mStartup;
+        LatencyHistogram& mLatency;
+        FrameStats& mFrameStats;
+        const FrameConfig mConfig;
+        const int mScreenWidth;
+        const int mScreenHeight;
+
+        std::thread mThread;
+        std::atomic<bool> mStop;
+        std::atomic<bool> mPresented;
+        std::atomic<uint64_t> mFrames;
+        FrameAllocations mAllocations;
+
+        SDL_Renderer* mRenderer;
+        std::unique_ptr<MenuView> mMenu;
+        std::unique_ptr<PuzzleView> mPuzzles[MAX_DIFFICULTY - MIN_DIFFICULTY + 1];
+
+        void run();
+        SceneView* viewFor(const FrameSnapshot& snapshot);
+
+    public:
+        RenderThread(SDL_Window* const window, TripleBuffer<FrameSnapshot>& snapshots, ResourceManager& resources,
+                     PictureLoader& picture, StartupProfile& startup, LatencyHistogram& latency, FrameStats& frameStats,
+                     const FrameConfig& config, const int SCREEN_WIDTH, const int SCREEN_HEIGHT);
+        ~RenderThread();
+
+        void start();
+        // Ve xong frame dang ve, giai phong moi thu cua luong ve roi cho luong ket thuc
+        void stop();
+        // true khi frame dau tien da hien len man hinh
+        bool hasPresented() const;
+        // So frame da present
+        uint64_t getFrameCount() const;
+        // Cap phat cua tung frame ve (chi dem khi build voi -DCOUNT_ALLOCATIONS)
+        const FrameAllocations& getAllocations() const;
+};
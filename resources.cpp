@@ -0,0 +1,205 @@
+#include <iostream>
+#include <tuple>
+#include "resources.h"
+#include "trace.h"
+
+using namespace std;
+
+// Noi tao cua mot texture/font dang song
+struct CallSite {
+    const char* kind;
+    const char* file;
+    int line;
+};
+
+// Texture tao tren luong ve, font tren luong preload, bao cao tu luong mo phong nen can khoa
+struct ResourceTracker {
+    mutex guard;
+    map<const void*, CallSite> live;
+    int textures;
+    int fonts;
+    unsigned long texturesCreated;
+    unsigned long texturesDestroyed;
+    unsigned long fontsOpened;
+    unsigned long fontsClosed;
+};
+
+static ResourceTracker tracker;
+
+SDL_Texture* trackTexture(SDL_Texture* texture, const char* file, const int line) {
+    if (texture != nullptr) {
+        lock_guard<mutex> lock(tracker.guard);
+        tracker.live[texture] = {"texture", file, line};
+        tracker.textures++;
+        tracker.texturesCreated++;
+    }
+    return texture;
+}
+
+void destroyTexture(SDL_Texture* texture) {
+    if (texture == nullptr)
+        return;
+    SDL_DestroyTexture(texture);
+    lock_guard<mutex> lock(tracker.guard);
+    if (tracker.live.erase(texture) == 0) {
+        cout << "Warning: destroyed an untracked texture!" << endl;
+        return;
+    }
+    tracker.textures--;
+    tracker.texturesDestroyed++;
+}
+
+TTF_Font* trackFont(TTF_Font* font, const char* file, const int line) {
+    if (font != nullptr) {
+        lock_guard<mutex> lock(tracker.guard);
+        tracker.live[font] = {"font", file, line};
+        tracker.fonts++;
+        tracker.fontsOpened++;
+    }
+    return font;
+}
+
+void closeFont(TTF_Font* font) {
+    if (font == nullptr)
+        return;
+    TTF_CloseFont(font);
+    lock_guard<mutex> lock(tracker.guard);
+    if (tracker.live.erase(font) == 0) {
+        cout << "Warning: closed an untracked font!" << endl;
+        return;
+    }
+    tracker.fonts--;
+    tracker.fontsClosed++;
+}
+
+void TextureDeleter::operator()(SDL_Texture* texture) const {
+    destroyTexture(texture);
+}
+
+int getTextureCount() {
+    lock_guard<mutex> lock(tracker.guard);
+    return tracker.textures;
+}
+
+int getLiveFontCount() {
+    lock_guard<mutex> lock(tracker.guard);
+    return tracker.fonts;
+}
+
+void reportLiveResources(const char* when) {
+    // Gom theo noi tao de moi cho ro ri chi in mot dong du co bao nhieu texture
+    lock_guard<mutex> lock(tracker.guard);
+    cout << "Live resources " << when << ": " << tracker.fonts << " fonts (" << tracker.fontsOpened << " opened, "
+         << tracker.fontsClosed << " closed), " << tracker.textures << " textures (" << tracker.texturesCreated
+         << " created, " << tracker.texturesDestroyed << " destroyed)" << endl;
+    map<tuple<string, string, int>, int> sites;
+    for (const auto& resource : tracker.live)
+        sites[make_tuple(resource.second.kind, resource.second.file, resource.second.line)]++;
+    for (const auto& site : sites)
+        cout << "    " << site.second << " " << get<0>(site.first) << (site.second > 1 ? "s" : "") << " from "
+             << get<1>(site.first) << ":" << get<2>(site.first) << endl;
+}
+
+ResourceManager::ResourceManager()
+    : mLoading(false) {
+}
+
+ResourceManager::~ResourceManager() {
+    free();
+}
+
+void ResourceManager::preload(const vector<FontRequest>& requests) {
+    if (mThread.joinable())
+        mThread.join();
+    mLoading = true;
+    mThread = thread(&ResourceManager::run, this, requests);
+}
+
+void ResourceManager::run(const vector<FontRequest> requests) {
+    traceThreadName("font preload");
+    for (const FontRequest& request : requests) {
+        if (mFonts.count({request.file, request.size}) != 0)
+            continue;
+        TTF_Font* font = openFont(request.file, request.size);
+        lock_guard<mutex> lock(mMutex);
+        mFonts[{request.file, request.size}] = font;
+        mFontLoaded.notify_all();
+    }
+    lock_guard<mutex> lock(mMutex);
+    mLoading = false;
+    mFontLoaded.notify_all();
+}
+
+bool ResourceManager::loadBakedFont(SDL_Renderer* const renderer) {
+    return BakedFont::isAvailable() && mBakedFont.load(renderer);
+}
+
+TTF_Font* ResourceManager::openFont(const string& file, const int size) {
+    TRACE_SCOPE("open font");
+    if (!TTF_WasInit() && TTF_Init() == -1) {
+        cout << "TTF_Init Error: " << TTF_GetError() << endl;
+        return nullptr;
+    }
+
+    // Doc ca file mot lan, cac font mo tu vung nho nay nen vung nho phai song lau hon font
+    auto found = mFiles.find(file);
+    if (found == mFiles.end()) {
+        SDL_RWops* rw = SDL_RWFromFile(file.c_str(), "rb");
+        if (rw == nullptr) {
+            cout << "Failed to open font file " << file << "! Error: " << SDL_GetError() << endl;
+            return nullptr;
+        }
+        vector<char> data(SDL_RWsize(rw));
+        const size_t read = SDL_RWread(rw, data.data(), 1, data.size());
+        SDL_RWclose(rw);
+        if (read != data.size()) {
+            cout << "Failed to read font file " << file << "! Error: " << SDL_GetError() << endl;
+            return nullptr;
+        }
+        found = mFiles.emplace(file, move(data)).first;
+    }
+
+    SDL_RWops* rw = SDL_RWFromConstMem(found->second.data(), found->second.size());
+    TTF_Font* font = TRACK_FONT(TTF_OpenFontRW(rw, 1, size));
+    if (font == nullptr)
+        cout << "Failed to load font! Error: " << TTF_GetError() << endl;
+    return font;
+}
+
+TTF_Font* ResourceManager::getFont(const string& file, const int size) {
+    unique_lock<mutex> lock(mMutex);
+    const pair<string, int> key(file, size);
+    mFontLoaded.wait(lock, [&] { return !mLoading || mFonts.count(key) != 0; });
+
+    auto found = mFonts.find(key);
+    if (found != mFonts.end())
+        return found->second;
+    // Luong preload da xong nen luong ve tu mo font
+    TTF_Font* font = openFont(file, size);
+    mFonts[key] = font;
+    return font;
+}
+
+TextFace ResourceManager::getFace(const string& file, const int size) {
+    const GlyphAtlas* atlas = mBakedFont.getAtlas(size);
+    if (atlas != nullptr)
+        return {nullptr, atlas};
+    return {getFont(file, size), nullptr};
+}
+
+void ResourceManager::report(const char* when) {
+    reportLiveResources(when);
+}
+
+void ResourceManager::free() {
+    if (mThread.joinable())
+        mThread.join();
+    mLoading = false;
+    for (auto& font : mFonts) {
+        if (font.second != nullptr)
+            closeFont(font.second);
+    }
+    mFonts.clear();
+    mFiles.clear();
+    mBakedFont.free();
+}
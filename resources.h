@@ -0,0 +1,78 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <utility>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include "glyphAtlas.h"
+#include "bakedFont.h"
+
+struct FontRequest {
+    std::string file;
+    int size;
+    // Cac ky tu se ve bang font nay, fontBaker chi ve san nhung ky tu nay
+    const char* characters;
+};
+
+// Font de ve chu: atlas ve san trong file chay neu co co chu nay, khong thi font TTF
+struct TextFace {
+    TTF_Font* font;
+    const GlyphAtlas* atlas;
+};
+
+class ResourceManager {
+    // Moi file font chi doc tu dia mot lan vao bo nho, moi co chu mo tu ban trong bo nho nay
+    // Font khoa theo (file, co chu) va dung chung cho menu va moi van choi, chi dong khi free()
+    // preload() mo truoc cac font se dung tren luong rieng; trong luc do luong ve khong mo font nao
+    // ma cho dung font can dung, nen FreeType khong bao gio bi goi mo font tu hai luong cung luc
+    // Co font ve san (BakedFont) thi getFace khong can den SDL_ttf, TTF_Init chi goi khi that su mo font
+    private:
+        BakedFont mBakedFont;
+        std::thread mThread;
+        std::mutex mMutex;
+        std::condition_variable mFontLoaded;
+        bool mLoading;
+        std::map<std::string, std::vector<char>> mFiles;
+        std::map<std::pair<std::string, int>, TTF_Font*> mFonts;
+
+        void run(const std::vector<FontRequest> requests);
+        TTF_Font* openFont(const std::string& file, const int size);
+
+    public:
+        ResourceManager();
+        ~ResourceManager();
+
+        // Tai font ve san thanh mot texture, false neu file chay khong co font ve san
+        bool loadBakedFont(SDL_Renderer* const renderer);
+        void preload(const std::vector<FontRequest>& requests);
+        // Chi cho khi font nay dang duoc luong preload mo, tra ve nullptr neu khong mo duoc
+        TTF_Font* getFont(const std::string& file, const int size);
+        TextFace getFace(const std::string& file, const int size);
+        // In texture va font dang song cung noi tao ra chung
+        void report(const char* when);
+        void free();
+};
+
+// Moi texture va font cua game tao/huy qua cac ham nay: dem so lan tao, so lan huy
+// va nho noi (file:dong) tao ra tung cai con song de in ra khi roi scene va khi thoat
+SDL_Texture* trackTexture(SDL_Texture* texture, const char* file, const int line);
+#define TRACK_TEXTURE(texture) trackTexture((texture), __FILE__, __LINE__)
+void destroyTexture(SDL_Texture* texture);
+TTF_Font* trackFont(TTF_Font* font, const char* file, const int line);
+#define TRACK_FONT(font) trackFont((font), __FILE__, __LINE__)
+void closeFont(TTF_Font* font);
+int getTextureCount();
+int getLiveFontCount();
+
+// Texture co mot chu so huu duy nhat, tu huy qua destroyTexture khi chu bi huy hoac reset
+struct TextureDeleter {
+    void operator()(SDL_Texture* texture) const;
+};
+typedef std::unique_ptr<SDL_Texture, TextureDeleter> TextureHandle;
+// In so texture va font dang song, gom theo noi tao
+void reportLiveResources(const char* when);
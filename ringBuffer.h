@@ -0,0 +1,54 @@
+#pragma once
+#include <stddef.h>
+#include <vector>
+
+template <typename T>
+class RingBuffer {
+    // Hang doi vong co suc chua co dinh: cap phat mot lan luc tao, push/pop/clear khong bao gio cap phat
+    // Khong tu khoa, dung chung giua cac luong thi ben ngoai phai khoa
+    private:
+        std::vector<T> mItems;
+        size_t mHead;
+        size_t mCount;
+
+    public:
+        RingBuffer(const size_t capacity)
+            : mItems(capacity), mHead(0), mCount(0) {
+        }
+
+        // Tra ve false khi da day
+        bool push(const T& item) {
+            if (mCount == mItems.size())
+                return false;
+            mItems[(mHead + mCount) % mItems.size()] = item;
+            mCount++;
+            return true;
+        }
+
+        // Tra ve false khi rong
+        bool pop(T& item) {
+            if (mCount == 0)
+                return false;
+            item = mItems[mHead];
+            mHead = (mHead + 1) % mItems.size();
+            mCount--;
+            return true;
+        }
+
+        void clear() {
+            mHead = 0;
+            mCount = 0;
+        }
+
+        size_t size() const {
+            return mCount;
+        }
+
+        size_t capacity() const {
+            return mItems.size();
+        }
+
+        bool empty() const {
+            return mCount == 0;
+        }
+};
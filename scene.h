@@ -0,0 +1,26 @@
+#pragma once
+#include <SDL2/SDL.h>
+
+enum SceneId {
+    SCENE_NONE,
+    SCENE_MENU,
+    SCENE_PUZZLE
+};
+
+struct FrameSnapshot;
+
+class Scene {
+    // Mot man hinh cua game, duoc tao mot lan va giu lai giua cac van, chi chua trang thai mo phong
+    // SceneManager goi handleEvent cho moi su kien, update theo buoc co dinh (now la thoi gian mo phong, ms)
+    // va publish de chup trang thai gui sang luong ve; scene khong goi lenh ve nao
+    public:
+        virtual ~Scene() {}
+
+        virtual void enter() {}
+        virtual void leave() {}
+        virtual void handleEvent(const SDL_Event& event) = 0;
+        virtual void update(const Uint32 now) {}
+        virtual void publish(FrameSnapshot& snapshot) const = 0;
+        // Scene muon chuyen sang sau frame nay, SCENE_NONE neu o lai
+        virtual SceneId nextScene() const = 0;
+};
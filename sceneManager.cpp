@@ -0,0 +1,223 @@
+#include <stdlib.h>
+#include <iostream>
+#include "sceneManager.h"
+#include "trace.h"
+
+using namespace std;
+
+// Do kho cua van choi trong che do kiem tra cap phat va so vong lap giua hai input gia
+const unsigned int CHECK_DIFFICULTY = 4;
+const int CHECK_INPUT_INTERVAL = 8;
+
+// Moi van cua che do soak: so lan bam phim mui ten va so buoc mo phong sau moi lan bam
+const int SOAK_MOVES = 8;
+const int SOAK_STEPS_PER_MOVE = 12;
+const SDL_Keycode SOAK_KEYS[4] = {SDLK_UP, SDLK_DOWN, SDLK_LEFT, SDLK_RIGHT};
+
+SceneManager::SceneManager(ResourceManager& resources, const PictureLoader& picture, TripleBuffer<FrameSnapshot>& snapshots,
+                           const RenderThread& renderThread, TelemetryWriter& telemetry, FrameStats& frameStats,
+                           const unsigned int SCREEN_WIDTH, const unsigned int SCREEN_HEIGHT)
+    : mResources(resources), mPicture(picture), mSnapshots(snapshots), mRenderThread(renderThread),
+      mTelemetry(telemetry), mFrameStats(frameStats),
+      mScreenWidth(SCREEN_WIDTH), mScreenHeight(SCREEN_HEIGHT),
+      mMenu(SCREEN_WIDTH, SCREEN_HEIGHT), mCurrent(&mMenu), mAllocations("simulation") {
+    mMenu.enter();
+}
+
+PuzzleScene& SceneManager::puzzleFor(const unsigned int difficulty) {
+    unique_ptr<PuzzleScene>& puzzle = mPuzzles[difficulty - MIN_DIFFICULTY];
+    if (!puzzle)
+        puzzle.reset(new PuzzleScene(mPicture, mTelemetry, mFrameStats, difficulty, mScreenWidth, mScreenHeight));
+    return *puzzle;
+}
+
+void SceneManager::switchTo(const SceneId next, const bool report) {
+    mCurrent->leave();
+    if (next == SCENE_PUZZLE) {
+        // Van moi chi dao lai bang, tile cua bang choi nay da co tu lan truoc
+        PuzzleScene& puzzle = puzzleFor(mMenu.getDifficulty());
+        puzzle.newGame(mMenu.getTileMode(), rand());
+        mCurrent = &puzzle;
+    }
+    else {
+        if (report)
+            mResources.report("after leaving the puzzle");
+        mMenu.enter();
+        mCurrent = &mMenu;
+    }
+}
+
+void SceneManager::publish(const FixedTimestep& timestep) {
+    TRACE_SCOPE("publish");
+    FrameSnapshot& snapshot = mSnapshots.back();
+    mCurrent->publish(snapshot);
+    snapshot.simTime = timestep.getTime() + (Uint32)(timestep.getAlpha() * 1000 / UPDATES_PER_SECOND);
+    snapshot.publishedAt = SDL_GetPerformanceCounter();
+    mSnapshots.publish();
+}
+
+const FrameAllocations& SceneManager::getAllocations() const {
+    return mAllocations;
+}
+
+void SceneManager::scriptInput(PuzzleScene& puzzle) {
+    // Lan luot cac duong input co hang doi va lich su: phim mui ten, bam mot tile, bam nut goi y
+    // Bam la mot cap nhan/nha tai cung mot diem nen khong thanh keo
+    SDL_Event event = {};
+    const int kind = rand() % 4;
+    if (kind < 2) {
+        event.type = SDL_KEYDOWN;
+        event.key.timestamp = SDL_GetTicks();
+        event.key.keysym.sym = SOAK_KEYS[rand() % 4];
+        puzzle.handleEvent(event);
+        return;
+    }
+    SDL_Point point;
+    if (kind == 2)
+        point = puzzle.cellCentre(rand() % CHECK_DIFFICULTY, rand() % CHECK_DIFFICULTY);
+    else {
+        const SDL_Rect& hint = puzzle.getHintButtonRect();
+        point = {hint.x + hint.w / 2, hint.y + hint.h / 2};
+    }
+    event.type = SDL_MOUSEBUTTONDOWN;
+    event.button.button = SDL_BUTTON_LEFT;
+    event.button.timestamp = SDL_GetTicks();
+    event.button.x = point.x;
+    event.button.y = point.y;
+    puzzle.handleEvent(event);
+    event.type = SDL_MOUSEBUTTONUP;
+    puzzle.handleEvent(event);
+}
+
+void SceneManager::run(const uint64_t checkFrames) {
+    // Mo phong chay theo buoc co dinh UPDATES_PER_SECOND, khong co lenh ve nao tren luong nay
+    // nen su kien duoc xu ly ngay ca khi luong ve dang cho vsync hay tai texture
+    const Uint64 frequency = SDL_GetPerformanceFrequency();
+    FixedTimestep timestep(frequency, UPDATES_PER_SECOND);
+    timestep.start(SDL_GetPerformanceCounter());
+    bool controllersReady = false;
+    uint64_t loops = 0;
+    if (checkFrames > 0)
+        mMenu.choose(CHECK_DIFFICULTY, TILE_MODE_NUMBERS);
+
+    SDL_Event event;
+    bool quit = false;
+    while (!quit) {
+        mAllocations.beginFrame();
+        // Ngu tung ms den lan cap nhat tiep theo, su kien den thi xu ly ngay
+        const Uint64 nextStep = SDL_GetPerformanceCounter() +
+                                (Uint64)((1.0 - timestep.getAlpha()) * frequency / UPDATES_PER_SECOND);
+        int pending = SDL_PollEvent(&event);
+        while (pending == 0 && SDL_GetPerformanceCounter() < nextStep) {
+            SDL_Delay(1);
+            pending = SDL_PollEvent(&event);
+        }
+        if (pending != 0) {
+            TRACE_SCOPE("events");
+            for (; pending != 0; pending = SDL_PollEvent(&event)) {
+                if (event.type == SDL_QUIT) {
+                    quit = true;
+                    break;
+                }
+                if (event.type == SDL_CONTROLLERDEVICEADDED)
+                    SDL_GameControllerOpen(event.cdevice.which);
+                // Su kien sau khi da chon chuyen scene thuoc ve scene moi
+                if (mCurrent->nextScene() != SCENE_NONE)
+                    switchTo(mCurrent->nextScene());
+                mCurrent->handleEvent(event);
+            }
+        }
+        if (quit)
+            break;
+        if (mCurrent->nextScene() != SCENE_NONE)
+            switchTo(mCurrent->nextScene());
+        if (checkFrames > 0 && mCurrent != &mMenu && ++loops % CHECK_INPUT_INTERVAL == 0)
+            scriptInput(puzzleFor(CHECK_DIFFICULTY));
+
+        const int updates = timestep.advance(SDL_GetPerformanceCounter());
+        for (int i = 0; i < updates; i++) {
+            TRACE_SCOPE("update");
+            timestep.step();
+            mCurrent->update(timestep.getTime());
+        }
+        publish(timestep);
+
+        // Frame dau tien da hien thi moi khoi tao tay cam
+        if (!controllersReady && mRenderThread.hasPresented()) {
+            initGameControllers();
+            controllersReady = true;
+        }
+        mAllocations.endFrame();
+        if (checkFrames > 0 && mRenderThread.getAllocations().getMeasured() >= checkFrames)
+            quit = true;
+    }
+    // Dong cua so giua van cung ket thuc van dang choi
+    mCurrent->leave();
+}
+
+bool SceneManager::presentScene(const FixedTimestep& timestep) {
+    // Frame thu hai ke tu luc publish chac chan da lay snapshot nay, false neu cua so bi dong
+    publish(timestep);
+    const uint64_t target = mRenderThread.getFrameCount() + 2;
+    SDL_Event event;
+    while (mRenderThread.getFrameCount() < target) {
+        while (SDL_PollEvent(&event) != 0) {
+            if (event.type == SDL_QUIT)
+                return false;
+        }
+        SDL_Delay(1);
+    }
+    return true;
+}
+
+bool SceneManager::soak(const unsigned int games) {
+    // Lan luot moi kich thuoc va moi cach ve tile, moi van bam vai phim mui ten ngau nhien
+    // Thoi gian mo phong chay nhanh hon thuc te, chi doi luong ve o cuoi van va khi ve menu
+    // Sau vong dau tien moi view, font va texture can dung deu da co nen cuoi moi vong sau
+    // so texture va font dang song khong duoc tang
+    const unsigned int sizes = MAX_DIFFICULTY - MIN_DIFFICULTY + 1;
+    const unsigned int round = sizes * NUMBER_OF_TILE_MODES;
+    FixedTimestep timestep(SDL_GetPerformanceFrequency(), UPDATES_PER_SECOND);
+    timestep.start(SDL_GetPerformanceCounter());
+    int textures = -1;
+    int fonts = -1;
+    bool flat = true;
+    unsigned int game = 0;
+    for (; game < games && flat; game++) {
+        mMenu.choose(MIN_DIFFICULTY + game % sizes, game / sizes % NUMBER_OF_TILE_MODES);
+        switchTo(SCENE_PUZZLE, false);
+        for (int move = 0; move < SOAK_MOVES; move++) {
+            SDL_Event key = {};
+            key.type = SDL_KEYDOWN;
+            key.key.timestamp = SDL_GetTicks();
+            key.key.keysym.sym = SOAK_KEYS[rand() % 4];
+            mCurrent->handleEvent(key);
+            for (int i = 0; i < SOAK_STEPS_PER_MOVE; i++) {
+                timestep.step();
+                mCurrent->update(timestep.getTime());
+            }
+        }
+        if (!presentScene(timestep))
+            break;
+        switchTo(SCENE_MENU, false);
+        if (!presentScene(timestep))
+            break;
+
+        if ((game + 1) % round != 0)
+            continue;
+        const int liveTextures = getTextureCount();
+        const int liveFonts = getLiveFontCount();
+        if (textures < 0) {
+            textures = liveTextures;
+            fonts = liveFonts;
+        }
+        else if (liveTextures > textures || liveFonts > fonts) {
+            cout << "Soak: live resources grew after game " << game + 1 << endl;
+            reportLiveResources("during soak");
+            flat = false;
+        }
+    }
+    mCurrent->leave();
+    cout << "Soak: " << game << " games, " << textures << " textures, " << fonts << " fonts after each round" << endl;
+    return flat && game == games;
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include <memory>
+#include <SDL2/SDL.h>
+#include "scene.h"
+#include "menuScene.h"
+#include "puzzleScene.h"
+#include "picture.h"
+#include "resources.h"
+#include "layout.h"
+#include "timing.h"
+#include "tripleBuffer.h"
+#include "snapshot.h"
+#include "renderThread.h"
+#include "telemetry.h"
+#include "allocCount.h"
+
+class SceneManager {
+    // May trang thai giua menu va bang choi, so huu vong lap su kien va mo phong tren luong chinh
+    // Menu tao luc khoi dong, bang choi cua moi kich thuoc tao lan dau chon va giu den khi thoat
+    // Sau moi vong trang thai cua scene hien tai duoc chup vao bo dem ba cho luong ve
+    private:
+        ResourceManager& mResources;
+        const PictureLoader& mPicture;
+        TripleBuffer<FrameSnapshot>& mSnapshots;
+        const RenderThread& mRenderThread;
+        TelemetryWriter& mTelemetry;
+        FrameStats& mFrameStats;
+        const unsigned int mScreenWidth;
+        const unsigned int mScreenHeight;
+
+        MenuScene mMenu;
+        std::unique_ptr<PuzzleScene> mPuzzles[MAX_DIFFICULTY - MIN_DIFFICULTY + 1];
+        Scene* mCurrent;
+        FrameAllocations mAllocations;
+
+        PuzzleScene& puzzleFor(const unsigned int difficulty);
+        void switchTo(const SceneId next, const bool report = true);
+        bool presentScene(const FixedTimestep& timestep);
+        void publish(const FixedTimestep& timestep);
+        void scriptInput(PuzzleScene& puzzle);
+
+    public:
+        SceneManager(ResourceManager& resources, const PictureLoader& picture, TripleBuffer<FrameSnapshot>& snapshots,
+                     const RenderThread& renderThread, TelemetryWriter& telemetry, FrameStats& frameStats,
+                     const unsigned int SCREEN_WIDTH, const unsigned int SCREEN_HEIGHT);
+
+        // Chay den khi nguoi choi dong cua so
+        // checkFrames > 0: kiem tra cap phat, vao thang bang choi 4x4, gui input gia (phim, bam tile, bam goi y)
+        // va thoat khi luong ve da do du checkFrames frame
+        void run(const uint64_t checkFrames = 0);
+        // Choi games van khong co input that, tra ve false neu so texture hay font tang dan qua cac van
+        bool soak(const unsigned int games);
+        // Cap phat cua tung vong mo phong (chi dem khi build voi -DCOUNT_ALLOCATIONS)
+        const FrameAllocations& getAllocations() const;
+};
@@ -0,0 +1,14 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include "snapshot.h"
+
+class SceneView {
+    // Phan ve cua mot scene, chi song tren luong ve: so huu texture, ap dung snapshot moi nhat roi ve
+    // Tao tu snapshot dau tien cua scene do va giu lai giua cac van nhu scene
+    public:
+        virtual ~SceneView() {}
+
+        // renderTime: thoi gian mo phong (ms) uoc tinh cho frame nay, dung de noi suy tile dang truot
+        virtual void apply(const FrameSnapshot& snapshot, const Uint32 renderTime) = 0;
+        virtual void render() = 0;
+};
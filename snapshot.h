@@ -0,0 +1,70 @@
+#pragma once
+#include <stdio.h>
+#include <SDL2/SDL.h>
+#include "scene.h"
+#include "layout.h"
+#include "userInterface.h"
+
+// Toi da so phan tu cua mot scene: bang lon nhat va ba nut
+const int MAX_SNAPSHOT_ELEMENTS = 40;
+static_assert(MAX_DIFFICULTY * MAX_DIFFICULTY + 3 <= MAX_SNAPSHOT_ELEMENTS, "snapshot too small for the largest board");
+static_assert(MENU_ELEMENTS <= MAX_SNAPSHOT_ELEMENTS, "snapshot too small for the menu");
+
+// Tren bang choi tile co id la so cua no, cac nut co id tu day
+const int SNAPSHOT_BUTTON_ID = 100;
+
+struct ElementSnapshot {
+    // Menu: chi so cua nut; bang choi: so cua tile hoac SNAPSHOT_BUTTON_ID + chi so nut
+    int id;
+    SDL_Rect rect;
+    SDL_Color colour;
+    SDL_Color fontColour;
+    char text[32];
+    // O trong, khong ve
+    bool hidden;
+    // Dang truot hoac dang bi keo: ve moi frame, khong nam trong backdrop
+    bool live;
+    // Dang truot tu from den to trong [start, start + duration] (thoi gian mo phong, ms), luong ve tu noi suy
+    bool moving;
+    SDL_Point from;
+    SDL_Point to;
+    Uint32 start;
+    Uint32 duration;
+};
+
+struct FrameSnapshot {
+    // Trang thai cua mot frame ma luong mo phong gui sang luong ve, khong doi sau khi publish
+    // Kich thuoc co dinh nen chep vao bo dem ba khong can cap phat
+    SceneId scene;
+    // Kich thuoc bang, 0 voi menu
+    int size;
+    // Tang moi van moi, luong ve bat dau lai dong ho va chon lai cach ve tile
+    unsigned int game;
+    bool solved;
+    bool picture;
+    bool showNumbers;
+    // Doi khi phan tinh (backdrop) can ve lai
+    unsigned int staticVersion;
+    // Thoi diem (SDL_GetTicks) cua input sinh ra lan truot gan nhat cua nguoi choi, 0 neu chua co
+    Uint32 inputTime;
+    // Tang moi lan truot cua nguoi choi bat dau chay (ca keo tha), 0 neu chua co
+    // Luong ve do do tre o lan present dau tien thay so moi, hai input cung ms van la hai mau
+    unsigned int inputSequence;
+    // Thoi gian mo phong (ms) tuong ung voi luc publish
+    Uint32 simTime;
+    // Bo dem hieu nang luc publish
+    Uint64 publishedAt;
+    int count;
+    ElementSnapshot elements[MAX_SNAPSHOT_ELEMENTS];
+};
+
+inline void snapshotElement(ElementSnapshot& element, const int id, const UserInterface& ui) {
+    element.id = id;
+    element.rect = ui.getRect();
+    element.colour = ui.getColour();
+    element.fontColour = ui.getFontColour();
+    snprintf(element.text, sizeof(element.text), "%s", ui.getText());
+    element.hidden = false;
+    element.live = false;
+    element.moving = false;
+}
@@ -0,0 +1,265 @@
+// Giai hang loat: doc bang tu file (moi dong mot bang), giai toi uu tren nhieu luong, in va ghi ket qua ngay khi xong
+// Moi ket qua la mot dong JSON them vao cuoi file output; chay lai voi cung file thi bo qua bang da giai,
+// Ctrl+C dung cac luong va bo ket qua dang do nen co the chay tiep bat cu luc nao
+// Chi dung libcore, khong can SDL
+// Tham so: instances.txt [--out file.jsonl] [--threads N] [--budget nut] [--blank-first]
+#include <signal.h>
+#include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "board.h"
+#include "solver.h"
+
+using namespace std;
+
+const string RESULTS_FILE = "solved.jsonl";
+
+struct BatchOptions {
+    string input;
+    string output;
+    unsigned int threads;
+    // 0 la khong gioi han
+    unsigned long long budget;
+    // Bang dich co o trong o goc tren trai (0 1 2 ... nhu bo 100 bang 4x4 cua Korf)
+    bool blankFirst;
+};
+
+struct Instance {
+    string id;
+    Board board;
+    int estimate;
+};
+
+// Trang thai dung chung cua cac luong giai; moi thu sau mutex chi doc ghi khi da khoa
+struct BatchState {
+    const BatchOptions& options;
+    const vector<Instance>& instances;
+    atomic<size_t> next;
+    mutex guard;
+    ofstream output;
+    unsigned int solved;
+    unsigned int gaveUp;
+    unsigned long long nodes;
+    double solveSeconds;
+
+    BatchState(const BatchOptions& options, const vector<Instance>& instances)
+        : options(options), instances(instances), next(0), solved(0), gaveUp(0), nodes(0), solveSeconds(0) {}
+};
+
+static atomic<bool> interrupted(false);
+
+static void onInterrupt(int) {
+    interrupted.store(true);
+}
+
+static bool parseOptions(int argc, char* args[], BatchOptions& options) {
+    options.output = RESULTS_FILE;
+    options.threads = thread::hardware_concurrency();
+    if (options.threads == 0)
+        options.threads = 1;
+    options.budget = 0;
+    options.blankFirst = false;
+    for (int i = 1; i < argc; i++) {
+        const string arg = args[i];
+        if (arg == "--out" && i + 1 < argc)
+            options.output = args[++i];
+        else if (arg == "--threads" && i + 1 < argc)
+            options.threads = max(1, atoi(args[++i]));
+        else if (arg == "--budget" && i + 1 < argc)
+            options.budget = strtoull(args[++i], nullptr, 10);
+        else if (arg == "--blank-first")
+            options.blankFirst = true;
+        else if (options.input.empty() && arg[0] != '-')
+            options.input = arg;
+        else
+            return false;
+    }
+    return !options.input.empty();
+}
+
+static bool isSquare(const size_t count) {
+    size_t size = 1;
+    while (size * size < count)
+        size++;
+    return size * size == count;
+}
+
+static vector<Instance> readInstances(const BatchOptions& options, int& invalid) {
+    // Moi dong: n*n so theo tung hang, co the them id o dau; bo qua dong trong va phan sau '#'
+    // Dong khong co id thi id la so thu tu cua dong
+    vector<Instance> instances;
+    ifstream input(options.input);
+    if (!input) {
+        cout << "Unable to read " << options.input << endl;
+        invalid++;
+        return instances;
+    }
+    string line;
+    int lineNumber = 0;
+    while (getline(input, line)) {
+        lineNumber++;
+        line = line.substr(0, line.find('#'));
+        istringstream fields(line);
+        vector<int> cells;
+        int value;
+        while (fields >> value)
+            cells.push_back(value);
+        if (cells.empty())
+            continue;
+
+        Instance instance;
+        instance.id = to_string(lineNumber);
+        if (!isSquare(cells.size()) && isSquare(cells.size() - 1)) {
+            instance.id = to_string(cells[0]);
+            cells.erase(cells.begin());
+        }
+        // Kiem tra truoc khi dung Board: o cua bang la uint8_t nen bang tu 16x16 tro len bi tran so,
+        // va isSolvable la O(n^4)
+        const size_t maxCells = (size_t)(maxSolverSize() * maxSolverSize());
+        if (cells.size() > maxCells) {
+            cout << options.input << ":" << lineNumber << ": " << cells.size() << " cells, boards larger than "
+                 << maxSolverSize() << "x" << maxSolverSize() << " are not supported, skipped" << endl;
+            invalid++;
+            continue;
+        }
+        if (options.blankFirst) {
+            // Xoay bang 180 do va doi so t thanh n*n - t: bang dich co o trong dau tien thanh bang dich cua game,
+            // cac o ke nhau van ke nhau nen so nuoc toi uu khong doi
+            const int count = (int)cells.size();
+            vector<int> rotated(count);
+            for (int i = 0; i < count; i++)
+                rotated[count - 1 - i] = (cells[i] == 0) ? 0 : count - cells[i];
+            cells = rotated;
+        }
+        if (!instance.board.setCells(cells) || !instance.board.isSolvable()) {
+            cout << options.input << ":" << lineNumber << ": not a solvable board, skipped" << endl;
+            invalid++;
+            continue;
+        }
+        instance.estimate = estimateDistance(instance.board);
+        instances.push_back(instance);
+    }
+    return instances;
+}
+
+static set<string> readSolved(const string& path, bool& endsWithNewline) {
+    // Id cua cac bang da co ket qua "found"; bang bi bo do het nut se duoc giai lai (co the voi --budget lon hon)
+    // Dong cuoi bi cat do bi ngat giua chung khong co "}" nen khong duoc tinh
+    set<string> solved;
+    endsWithNewline = true;
+    ifstream input(path);
+    string line;
+    while (getline(input, line)) {
+        endsWithNewline = !input.eof();
+        const size_t id = line.find("\"id\":\"");
+        if (id == string::npos || line.find("\"status\":\"found\"") == string::npos || line.back() != '}')
+            continue;
+        const size_t start = id + 6;
+        solved.insert(line.substr(start, line.find('"', start) - start));
+    }
+    return solved;
+}
+
+static void solveWorker(BatchState& state) {
+    const unsigned long long budget = (state.options.budget == 0) ? ~0ULL : state.options.budget;
+    while (!interrupted.load()) {
+        const size_t index = state.next.fetch_add(1);
+        if (index >= state.instances.size())
+            return;
+        const Instance& instance = state.instances[index];
+
+        const auto start = chrono::steady_clock::now();
+        const SolveResult result = solveOptimal(instance.board, budget, &interrupted);
+        const double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        // Bi ngat giua chung: khong ghi gi, lan chay sau giai lai bang nay
+        if (result.status == SOLVE_CANCELLED)
+            return;
+
+        const bool found = (result.status == SOLVE_FOUND);
+        lock_guard<mutex> lock(state.guard);
+        state.output << "{\"id\":\"" << instance.id << "\",\"size\":" << instance.board.getSize()
+                     << ",\"status\":\"" << (found ? "found" : "gaveUp") << "\",\"length\":";
+        if (found)
+            state.output << result.moves.size();
+        else
+            state.output << "null";
+        state.output << ",\"estimate\":" << instance.estimate << ",\"nodes\":" << result.nodes
+                     << ",\"ms\":" << seconds * 1000 << "}\n";
+        state.output.flush();
+
+        cout << instance.id << ": ";
+        if (found)
+            cout << "length " << result.moves.size();
+        else
+            cout << "gave up";
+        cout << " (estimate " << instance.estimate << "), " << result.nodes << " nodes, " << seconds * 1000 << " ms, "
+             << result.nodes / max(seconds, 1e-9) << " nodes/s" << endl;
+
+        if (found)
+            state.solved++;
+        else
+            state.gaveUp++;
+        state.nodes += result.nodes;
+        state.solveSeconds += seconds;
+    }
+}
+
+int main(int argc, char* args[]) {
+    BatchOptions options;
+    if (!parseOptions(argc, args, options)) {
+        cout << "Usage: solveBatch instances.txt [--out file.jsonl] [--threads N] [--budget nodes] [--blank-first]"
+             << endl;
+        return 1;
+    }
+
+    int invalid = 0;
+    const vector<Instance> all = readInstances(options, invalid);
+    bool endsWithNewline;
+    const set<string> done = readSolved(options.output, endsWithNewline);
+    vector<Instance> instances;
+    for (const Instance& instance : all) {
+        if (done.count(instance.id) == 0)
+            instances.push_back(instance);
+    }
+    cout << all.size() << " instances, " << all.size() - instances.size() << " already solved in " << options.output
+         << ", " << instances.size() << " to solve on " << options.threads << " threads" << endl;
+
+    // Pattern database tao truoc khi chia luong de thoi gian cua bang dau tien khong tinh ca viec tao
+    preparePatternDatabase();
+
+    BatchState state(options, instances);
+    state.output.open(options.output, ios::app);
+    if (!state.output) {
+        cout << "Unable to write " << options.output << endl;
+        return 1;
+    }
+    if (!endsWithNewline)
+        state.output << "\n";
+    signal(SIGINT, onInterrupt);
+
+    const auto start = chrono::steady_clock::now();
+    vector<thread> workers;
+    workers.reserve(options.threads);
+    for (unsigned int i = 0; i < options.threads; i++)
+        workers.emplace_back(solveWorker, ref(state));
+    for (thread& worker : workers)
+        worker.join();
+    const double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    const unsigned int finished = state.solved + state.gaveUp;
+    cout << "Solved " << state.solved << ", gave up " << state.gaveUp << ", invalid " << invalid << ", unfinished "
+         << instances.size() - finished << " in " << seconds << " s: " << state.nodes << " nodes, "
+         << state.nodes / max(seconds, 1e-9) << " nodes/s, " << finished / max(seconds, 1e-9) << " instances/s"
+         << " (solver time " << state.solveSeconds << " s)" << endl;
+    if (interrupted.load())
+        cout << "Interrupted, run again with the same --out to resume" << endl;
+    return (invalid == 0 && state.gaveUp == 0 && finished == instances.size()) ? 0 : 1;
+}
@@ -0,0 +1,313 @@
+#include <stdlib.h>
+#include <limits.h>
+#include <deque>
+#include <mutex>
+#include "solver.h"
+
+using namespace std;
+
+static const int MAX_SIZE = 8;
+static const int MAX_CELLS = MAX_SIZE * MAX_SIZE;
+
+// Pattern database cho bang 4x4: ba nhom 5 tile, moi nhom chi dem nuoc di cua tile trong nhom
+static const int PATTERN_COUNT = 3;
+static const int PATTERN_TILES = 5;
+static const int PATTERNS[PATTERN_COUNT][PATTERN_TILES] = {{1, 2, 3, 4, 7}, {5, 6, 9, 10, 13}, {8, 11, 12, 14, 15}};
+static const int PATTERN_WEIGHTS[PATTERN_TILES] = {65536, 4096, 256, 16, 1};
+static const int PATTERN_ENTRIES = 16 * 16 * 16 * 16 * 16;
+
+static vector<uint8_t> patternDatabase[PATTERN_COUNT];
+static int patternOf[16];
+static int slotOf[16];
+static once_flag patternOnce;
+
+struct SolverState {
+    int size;
+    uint8_t cells[MAX_CELLS];
+    int blank;
+    // Danh chi so theo gia tri tile (1..size*size), o 0 bo trong
+    int goalRow[MAX_CELLS + 1];
+    int goalCol[MAX_CELLS + 1];
+
+    // Heuristic Manhattan + linear conflict
+    int manhattan;
+    int rowConflict[MAX_SIZE];
+    int colConflict[MAX_SIZE];
+    int conflicts;
+
+    // Heuristic pattern database (chi dung cho 4x4)
+    bool usePatterns;
+    int patternIndex[PATTERN_COUNT];
+
+    vector<Move> path;
+    unsigned long long nodes;
+    unsigned long long budget;
+    const atomic<bool>* cancel;
+    bool stopped;
+};
+
+static void buildPattern(const int pattern) {
+    // 0-1 BFS nguoc tu trang thai dich tren (vi tri 5 tile, vi tri o trong)
+    // Doi cho o trong voi tile ngoai nhom ton 0, voi tile trong nhom ton 1
+    vector<uint8_t> distance((size_t)PATTERN_ENTRIES * 16, 255);
+    vector<uint8_t>& database = patternDatabase[pattern];
+    database.assign(PATTERN_ENTRIES, 255);
+
+    uint32_t config = 0;
+    for (int j = 0; j < PATTERN_TILES; j++)
+        config += (PATTERNS[pattern][j] - 1) * PATTERN_WEIGHTS[j];
+    const uint32_t start = config * 16 + 15;
+    distance[start] = 0;
+
+    deque<uint32_t> queue;
+    queue.push_back(start);
+    while (!queue.empty()) {
+        const uint32_t state = queue.front();
+        queue.pop_front();
+        const uint32_t current = state >> 4;
+        const int blank = state & 15;
+        const uint8_t cost = distance[state];
+        if (cost < database[current])
+            database[current] = cost;
+
+        int positions[PATTERN_TILES];
+        for (int j = 0; j < PATTERN_TILES; j++)
+            positions[j] = (current / PATTERN_WEIGHTS[j]) % 16;
+
+        for (int i = 0; i < 4; i++) {
+            const int row = blank / 4 + MOVE_DELTAS[i][0];
+            const int col = blank % 4 + MOVE_DELTAS[i][1];
+            if (row < 0 || row > 3 || col < 0 || col > 3)
+                continue;
+            const int neighbor = row * 4 + col;
+
+            uint32_t next = current;
+            uint8_t step = 0;
+            for (int j = 0; j < PATTERN_TILES; j++) {
+                if (positions[j] == neighbor) {
+                    next = current + (blank - neighbor) * PATTERN_WEIGHTS[j];
+                    step = 1;
+                    break;
+                }
+            }
+
+            const uint32_t nextState = next * 16 + neighbor;
+            if (distance[nextState] > cost + step) {
+                distance[nextState] = cost + step;
+                if (step == 0)
+                    queue.push_front(nextState);
+                else
+                    queue.push_back(nextState);
+            }
+        }
+    }
+}
+
+void preparePatternDatabase() {
+    call_once(patternOnce, []() {
+        for (int pattern = 0; pattern < PATTERN_COUNT; pattern++) {
+            for (int j = 0; j < PATTERN_TILES; j++) {
+                patternOf[PATTERNS[pattern][j]] = pattern;
+                slotOf[PATTERNS[pattern][j]] = j;
+            }
+            buildPattern(pattern);
+        }
+    });
+}
+
+static int tileDistance(const SolverState& state, const int index, const int value) {
+    return abs(index / state.size - state.goalRow[value]) + abs(index % state.size - state.goalCol[value]);
+}
+
+static int lineConflict(const SolverState& state, const int line, const bool isRow) {
+    // Cac tile thuoc dung hang (cot) nay nhung sai thu tu: 2 * (so tile - day con tang dai nhat)
+    int goals[MAX_SIZE];
+    int count = 0;
+    for (int k = 0; k < state.size; k++) {
+        const int index = isRow ? line * state.size + k : k * state.size + line;
+        const int value = state.cells[index];
+        if (value == 0)
+            continue;
+        if (isRow && state.goalRow[value] == line)
+            goals[count++] = state.goalCol[value];
+        else if (!isRow && state.goalCol[value] == line)
+            goals[count++] = state.goalRow[value];
+    }
+
+    int longest[MAX_SIZE];
+    int best = 0;
+    for (int i = 0; i < count; i++) {
+        longest[i] = 1;
+        for (int j = 0; j < i; j++) {
+            if (goals[j] < goals[i] && longest[j] + 1 > longest[i])
+                longest[i] = longest[j] + 1;
+        }
+        if (longest[i] > best)
+            best = longest[i];
+    }
+    return 2 * (count - best);
+}
+
+static int patternIndexOf(const SolverState& state, const int pattern) {
+    int index = 0;
+    for (int i = 0; i < 16; i++) {
+        const int value = state.cells[i];
+        if (value != 0 && patternOf[value] == pattern)
+            index += i * PATTERN_WEIGHTS[slotOf[value]];
+    }
+    return index;
+}
+
+static void initState(SolverState& state, const Board& board) {
+    state.size = board.getSize();
+    state.blank = board.getBlankIndex();
+    for (int i = 0; i < state.size * state.size; i++) {
+        state.cells[i] = board.getCellAt(i);
+        state.goalRow[i + 1] = i / state.size;
+        state.goalCol[i + 1] = i % state.size;
+    }
+
+    state.manhattan = 0;
+    for (int i = 0; i < state.size * state.size; i++) {
+        if (state.cells[i] != 0)
+            state.manhattan += tileDistance(state, i, state.cells[i]);
+    }
+    state.conflicts = 0;
+    for (int line = 0; line < state.size; line++) {
+        state.rowConflict[line] = lineConflict(state, line, true);
+        state.colConflict[line] = lineConflict(state, line, false);
+        state.conflicts += state.rowConflict[line] + state.colConflict[line];
+    }
+
+    state.usePatterns = (state.size == 4);
+    if (state.usePatterns) {
+        preparePatternDatabase();
+        for (int pattern = 0; pattern < PATTERN_COUNT; pattern++)
+            state.patternIndex[pattern] = patternIndexOf(state, pattern);
+    }
+}
+
+static int heuristic(const SolverState& state) {
+    if (state.usePatterns) {
+        int total = 0;
+        for (int pattern = 0; pattern < PATTERN_COUNT; pattern++)
+            total += patternDatabase[pattern][state.patternIndex[pattern]];
+        return total;
+    }
+    return state.manhattan + state.conflicts;
+}
+
+static void refreshConflicts(SolverState& state, int* lines, const int line, const bool isRow) {
+    state.conflicts -= lines[line];
+    lines[line] = lineConflict(state, line, isRow);
+    state.conflicts += lines[line];
+}
+
+static void slide(SolverState& state, const Move move) {
+    // Dua tile ke ben vao o trong va cap nhat heuristic tang dan
+    const int from = state.blank + MOVE_DELTAS[move][0] * state.size + MOVE_DELTAS[move][1];
+    const int to = state.blank;
+    const int value = state.cells[from];
+
+    state.manhattan += tileDistance(state, to, value) - tileDistance(state, from, value);
+    state.cells[to] = value;
+    state.cells[from] = 0;
+    state.blank = from;
+
+    if (state.usePatterns) {
+        state.patternIndex[patternOf[value]] += (to - from) * PATTERN_WEIGHTS[slotOf[value]];
+    }
+    else if (move == MOVE_UP || move == MOVE_DOWN) {
+        // Tile doi hang: chi hai hang lien quan thay doi xung dot
+        refreshConflicts(state, state.rowConflict, from / state.size, true);
+        refreshConflicts(state, state.rowConflict, to / state.size, true);
+    }
+    else {
+        refreshConflicts(state, state.colConflict, from % state.size, false);
+        refreshConflicts(state, state.colConflict, to % state.size, false);
+    }
+}
+
+static bool canSlide(const SolverState& state, const Move move) {
+    const int row = state.blank / state.size + MOVE_DELTAS[move][0];
+    const int col = state.blank % state.size + MOVE_DELTAS[move][1];
+    return (row >= 0 && row < state.size && col >= 0 && col < state.size);
+}
+
+static bool search(SolverState& state, const int g, const int bound, const Move previous, int& nextBound) {
+    const int h = heuristic(state);
+    if (g + h > bound) {
+        if (g + h < nextBound)
+            nextBound = g + h;
+        return false;
+    }
+    if (h == 0)
+        return true;
+
+    state.nodes++;
+    if (state.nodes > state.budget ||
+        ((state.nodes & 1023) == 0 && state.cancel != nullptr && state.cancel->load(memory_order_relaxed))) {
+        state.stopped = true;
+        return false;
+    }
+
+    for (int i = 0; i < 4; i++) {
+        const Move move = (Move)i;
+        if (move == inverseMove(previous) || !canSlide(state, move))
+            continue;
+
+        slide(state, move);
+        state.path.push_back(move);
+        if (search(state, g + 1, bound, move, nextBound))
+            return true;
+        state.path.pop_back();
+        slide(state, inverseMove(move));
+        if (state.stopped)
+            return false;
+    }
+    return false;
+}
+
+SolveResult solveOptimal(const Board& board, const unsigned long long nodeBudget, const atomic<bool>* cancel) {
+    SolveResult result = {SOLVE_GAVE_UP, vector<Move>(), 0};
+    if (board.getSize() > MAX_SIZE)
+        return result;
+
+    SolverState state;
+    initState(state, board);
+    state.nodes = 0;
+    state.budget = nodeBudget;
+    state.cancel = cancel;
+    state.stopped = false;
+
+    int bound = heuristic(state);
+    while (true) {
+        int nextBound = INT_MAX;
+        if (search(state, 0, bound, MOVE_NONE, nextBound)) {
+            result.status = SOLVE_FOUND;
+            result.moves = state.path;
+            break;
+        }
+        if (state.stopped) {
+            const bool cancelled = (cancel != nullptr && cancel->load());
+            result.status = cancelled ? SOLVE_CANCELLED : SOLVE_GAVE_UP;
+            break;
+        }
+        bound = nextBound;
+    }
+    result.nodes = state.nodes;
+    return result;
+}
+
+int estimateDistance(const Board& board) {
+    if (board.getSize() > MAX_SIZE)
+        return -1;
+
+    SolverState state;
+    initState(state, board);
+    return heuristic(state);
+}
+
+int maxSolverSize() {
+    return MAX_SIZE;
+}
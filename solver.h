@@ -0,0 +1,30 @@
+#pragma once
+#include <vector>
+#include <atomic>
+#include "board.h"
+
+enum SolveStatus {
+    SOLVE_FOUND,
+    SOLVE_GAVE_UP,      // Vuot qua so nut cho phep
+    SOLVE_CANCELLED
+};
+
+struct SolveResult {
+    SolveStatus status;
+    std::vector<Move> moves;
+    unsigned long long nodes;
+};
+
+// Giai toi uu bang IDA*, dung lai khi vuot qua nodeBudget nut hoac khi *cancel chuyen thanh true
+// Bang 4x4 dung pattern database 5-5-5, cac kich thuoc khac dung Manhattan + linear conflict
+SolveResult solveOptimal(const Board& board, const unsigned long long nodeBudget,
+                         const std::atomic<bool>* cancel = nullptr);
+
+// Gia tri heuristic (chan duoi cua so nuoc di toi uu) cua mot bang, -1 neu bang lon hon maxSolverSize()
+int estimateDistance(const Board& board);
+
+// Kich thuoc bang lon nhat ma solver giai duoc
+int maxSolverSize();
+
+// Tao pattern database cho bang 4x4, chi chay mot lan, mat khoang nua giay
+void preparePatternDatabase();
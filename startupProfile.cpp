@@ -0,0 +1,46 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include "startupProfile.h"
+
+using namespace std;
+
+// Khoi tao truoc main, gan nhat voi luc tien trinh bat dau ma khong can API rieng cua he dieu hanh
+static const chrono::steady_clock::time_point PROCESS_START = chrono::steady_clock::now();
+
+StartupProfile::StartupProfile(const bool report)
+    : mReport(report), mFinished(false) {
+    mPhases.reserve(16);
+}
+
+void StartupProfile::mark(const char* phase) {
+    lock_guard<mutex> lock(mMutex);
+    const long long elapsed = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - PROCESS_START).count();
+    mPhases.push_back({phase, elapsed});
+}
+
+void StartupProfile::finish() {
+    if (mFinished)
+        return;
+    mark("first present");
+    lock_guard<mutex> lock(mMutex);
+    mFinished = true;
+
+    const long long total = mPhases.back().second;
+    if (mReport) {
+        cout << "Startup profile (us):" << endl;
+        long long previous = 0;
+        for (const auto& phase : mPhases) {
+            cout << setw(10) << phase.second << setw(10) << "+" + to_string(phase.second - previous) << "  " << phase.first << endl;
+            previous = phase.second;
+        }
+    }
+    if (mReport || total > STARTUP_BUDGET_US) {
+        cout << "Time to first frame: " << total << " us (budget " << STARTUP_BUDGET_US << " us)"
+             << (total > STARTUP_BUDGET_US ? " OVER BUDGET" : "") << endl;
+    }
+}
+
+bool StartupProfile::isFinished() const {
+    return mFinished;
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include <vector>
+#include <utility>
+#include <mutex>
+
+// Thoi gian toi da tu luc bat dau tien trinh den frame dau tien (micro giay)
+const long long STARTUP_BUDGET_US = 200000;
+
+class StartupProfile {
+    // Ghi lai thoi diem cua tung moc khoi dong, tinh tu luc tien trinh bat dau (micro giay)
+    // Bao cao chi in ra khi co --startup-report, rieng vuot ngan sach thi luon canh bao
+    // Luong chinh va luong ve cung danh dau moc nen danh sach moc duoc khoa
+    private:
+        std::mutex mMutex;
+        std::vector<std::pair<const char*, long long>> mPhases;
+        bool mReport;
+        bool mFinished;
+
+    public:
+        StartupProfile(const bool report);
+
+        void mark(const char* phase);
+        // Moc cuoi cung: frame dau tien da hien len man hinh
+        void finish();
+        bool isFinished() const;
+};
@@ -1,3 +1,5 @@
+#include <stdio.h>
+#include <string.h>
 #include "stopwatch.h"
 
 Stopwatch::Stopwatch(const SDL_Rect& rect, const SDL_Color& colour, TTF_Font* const font, const SDL_Color& fontColour) 
@@ -6,19 +8,20 @@ Stopwatch::Stopwatch(const SDL_Rect& rect, const SDL_Color& colour, TTF_Font* co
     
 }
 
-void Stopwatch::start() {
-    time(&mStartTime);
+void Stopwatch::start(const Uint32 now) {
+    mStartTime = now;
 }
 
-void Stopwatch::calculateTime(SDL_Renderer* const renderer, bool solved) {
-    time_t difference = time(NULL) - mStartTime;
-    struct tm* timeinfo = gmtime(&difference);
-    strftime(mElapsedTime, sizeof(mElapsedTime), "%H:%M:%S", timeinfo);
-
-    char attitude[11] = "In danger ";
-
-    if(!solved)
-        loadTexture(renderer, strcat(attitude, mElapsedTime));
+void Stopwatch::calculateTime(SDL_Renderer* const renderer, bool solved, const Uint32 now) {
+    // Van ban chi doi moi giay nen chi ve lai chu khi no thuc su doi, cac frame con lai khong cap phat gi
+    if (!solved) {
+        const long difference = (now > mStartTime) ? (now - mStartTime) / 1000 : 0;
+        snprintf(mElapsedTime, sizeof(mElapsedTime), "In danger %02ld:%02ld:%02ld",
+                 difference / 3600 % 24, difference / 60 % 60, difference % 60);
+    }
     else
-        loadTexture(renderer, "YOU'RE SAFE");
+        snprintf(mElapsedTime, sizeof(mElapsedTime), "YOU'RE SAFE");
+
+    if (strcmp(mElapsedTime, mText) != 0 || (mAtlas == nullptr && mTexture == nullptr))
+        loadTexture(renderer, mElapsedTime);
 }
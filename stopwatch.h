@@ -1,19 +1,21 @@
 #pragma once
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
-#include <time.h>
 #include <iostream>
 #include "userInterface.h"
 
 class Stopwatch : public UserInterface {
+    // Dem theo thoi gian mo phong (ms) cua frame dang ve chu khong theo dong ho he thong,
+    // nen cung mot chuoi frame luon ve ra cung mot hinh
     private:
-        time_t mStartTime;
-        char mElapsedTime[80];
+        Uint32 mStartTime;
+        // Van ban dang hien, vua voi mText cua UserInterface
+        char mElapsedTime[32];
 
     public:
         Stopwatch(const SDL_Rect& rect, const SDL_Color& colour, TTF_Font* const font, const SDL_Color& fontColour);
 
-        void start();
-        void calculateTime(SDL_Renderer* const renderer, bool solved);
+        void start(const Uint32 now);
+        void calculateTime(SDL_Renderer* const renderer, bool solved, const Uint32 now);
         
 };
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include <iostream>
+#include <fstream>
+#include "telemetry.h"
+#include "solver.h"
+#include "trace.h"
+
+using namespace std;
+
+FrameStats::FrameStats()
+    : mCount(0), mTotal(0), mMax(0) {
+}
+
+void FrameStats::reset() {
+    mCount = 0;
+    mTotal = 0;
+    mMax = 0;
+}
+
+void FrameStats::record(const uint64_t microSeconds) {
+    mCount.fetch_add(1, memory_order_relaxed);
+    mTotal.fetch_add(microSeconds, memory_order_relaxed);
+    uint64_t max = mMax.load(memory_order_relaxed);
+    while (microSeconds > max && !mMax.compare_exchange_weak(max, microSeconds, memory_order_relaxed)) {
+    }
+}
+
+uint64_t FrameStats::getCount() const {
+    return mCount.load(memory_order_relaxed);
+}
+
+uint64_t FrameStats::getMean() const {
+    const uint64_t count = getCount();
+    return (count == 0) ? 0 : mTotal.load(memory_order_relaxed) / count;
+}
+
+uint64_t FrameStats::getMax() const {
+    return mMax.load(memory_order_relaxed);
+}
+
+TelemetryWriter::TelemetryWriter(const string& path)
+    : mPath(path), mCancel(false), mQuit(false) {
+    mThread = thread(&TelemetryWriter::run, this);
+}
+
+TelemetryWriter::~TelemetryWriter() {
+    stop();
+}
+
+void TelemetryWriter::submit(SessionRecord record) {
+    lock_guard<mutex> lock(mMutex);
+    mRecords.push_back(move(record));
+    mCondition.notify_one();
+}
+
+void TelemetryWriter::stop() {
+    {
+        lock_guard<mutex> lock(mMutex);
+        mQuit = true;
+        mCondition.notify_one();
+    }
+    mCancel = true;
+    if (mThread.joinable())
+        mThread.join();
+}
+
+static void writeRecord(ostream& output, const SessionRecord& record, const int optimal) {
+    output << "{\"size\":" << record.size << ",\"seed\":" << record.seed
+           << ",\"solved\":" << (record.solved ? "true" : "false")
+           << ",\"autoSolved\":" << (record.autoSolved ? "true" : "false")
+           << ",\"hints\":" << record.hints << ",\"moves\":" << record.moves << ",\"par\":" << record.par
+           << ",\"optimal\":";
+    if (optimal < 0)
+        output << "null";
+    else
+        output << optimal;
+    output << ",\"totalMs\":" << record.totalTime << ",\"thinkMs\":[";
+    for (size_t i = 0; i < record.thinkTimes.size(); i++)
+        output << (i == 0 ? "" : ",") << record.thinkTimes[i];
+    output << "],\"frames\":" << record.frames << ",\"frameMeanUs\":" << record.frameMean
+           << ",\"frameMaxUs\":" << record.frameMax << "}\n";
+}
+
+void TelemetryWriter::run() {
+    traceThreadName("telemetry");
+    ofstream output;
+    while (true) {
+        SessionRecord record;
+        {
+            unique_lock<mutex> lock(mMutex);
+            mCondition.wait(lock, [this]() { return !mRecords.empty() || mQuit; });
+            if (mRecords.empty())
+                break;
+            record = move(mRecords.front());
+            mRecords.pop_front();
+        }
+        if (mPath.empty())
+            continue;
+        TRACE_SCOPE("telemetry record");
+
+        // So nuoc toi uu chi biet duoc khi bang du nho de giai kip, khong thi ghi null
+        int optimal = -1;
+        if (record.size <= 4 && !mCancel) {
+            const SolveResult result = solveOptimal(record.start, TELEMETRY_NODE_BUDGET, &mCancel);
+            if (result.status == SOLVE_FOUND)
+                optimal = result.moves.size();
+        }
+
+        // File chi mo khi co ban ghi dau tien
+        if (!output.is_open()) {
+            output.open(mPath, ios::app);
+            if (!output) {
+                cout << "Unable to write " << mPath << endl;
+                return;
+            }
+        }
+        writeRecord(output, record, optimal);
+        output.flush();
+    }
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include "board.h"
+
+// So nut toi da khi tinh so nuoc toi uu cua bang ban dau, chi thu voi bang tu 4x4 tro xuong
+const unsigned long long TELEMETRY_NODE_BUDGET = 20000000ULL;
+
+class FrameStats {
+    // Thoi gian giua hai lan present (micro giay): luong ve ghi, luong mo phong dat lai va doc moi van
+    private:
+        std::atomic<uint64_t> mCount;
+        std::atomic<uint64_t> mTotal;
+        std::atomic<uint64_t> mMax;
+
+    public:
+        FrameStats();
+
+        void reset();
+        void record(const uint64_t microSeconds);
+        uint64_t getCount() const;
+        uint64_t getMean() const;
+        uint64_t getMax() const;
+};
+
+struct SessionRecord {
+    int size;
+    unsigned int seed;
+    bool solved;
+    bool autoSolved;
+    unsigned int hints;
+    // So tile nguoi choi da day (khong tinh nuoc tu giai)
+    unsigned int moves;
+    // Do dai loi giai rut gon tu qua trinh dao bang
+    unsigned int par;
+    // Bang ngay sau khi dao, luong ghi tinh so nuoc toi uu tu day
+    Board start;
+    // Thoi gian suy nghi truoc moi lan truot cua nguoi choi (ms)
+    std::vector<uint32_t> thinkTimes;
+    uint32_t totalTime;
+    uint64_t frames;
+    uint64_t frameMean;
+    uint64_t frameMax;
+};
+
+class TelemetryWriter {
+    // Moi van choi la mot dong JSON them vao cuoi file (JSON lines)
+    // submit chi dua ban ghi vao hang doi; tinh so nuoc toi uu, ghi va flush deu tren luong rieng
+    private:
+        std::string mPath;
+        std::thread mThread;
+        std::mutex mMutex;
+        std::condition_variable mCondition;
+        std::deque<SessionRecord> mRecords;
+        std::atomic<bool> mCancel;
+        bool mQuit;
+
+        void run();
+
+    public:
+        // path rong thi bo qua moi ban ghi (van chay thu, khong phai nguoi choi)
+        TelemetryWriter(const std::string& path);
+        ~TelemetryWriter();
+
+        void submit(SessionRecord record);
+        // Ghi not cac ban ghi con lai (bo qua tinh so nuoc toi uu) roi dung luong
+        void stop();
+};
@@ -1,3 +1,4 @@
+#include <stdio.h>
 #include "tile.h"
 
 using namespace std;
@@ -6,6 +7,7 @@ Tile::Tile(const SDL_Rect& rect, const SDL_Color& colour, TTF_Font* const font,
     : Button(rect, colour, font, fontColour)
     {
         mNumber = number;
+        mPictureRect = {0, 0, 0, 0};
 }
 
 int Tile::getXPosition() {
@@ -16,33 +18,33 @@ int Tile::getYPosition() {
     return mRect.y;
 }                                                                                                                                                                                                                                                                      
 
-bool Tile::moveTo(const int x, const int y) {
-    // Di chuyen tile den muc tieu co toa do x, y tung doan mot la 1 hoac - 1 
-
-    if (mRect.x != x) {
-        const int delta = (x - mRect.x > 0) ? 1 : -1;
-        mRect.x += delta;
-        mFontRect.x += delta;
-        return false;
-    } 
-
-    if (mRect.y != y) {
-        const int delta = (y - mRect.y > 0) ? 1 : -1;
-        mRect.y += delta;
-        mFontRect.y += delta;
-        return false;
-    }
-
-    // Neu da den noi thi la true, chua den thi false
-    return true;
-}
-
 void Tile::setPositionTo(const int x, const int y) {
     mRect.x = x;
     mRect.y = y;
     centerText();
 }
 
-int Tile::getNumber() {
+int Tile::getNumber() const {
     return mNumber;
+}
+
+void Tile::setPictureRect(const SDL_Rect& rect) {
+    mPictureRect = rect;
+}
+
+void Tile::renderPicture(SDL_Renderer* const renderer, SDL_Texture* const picture, const GlyphAtlas* const numbers) const {
+    SDL_RenderCopy(renderer, picture, &mPictureRect, &mRect);
+
+    // Vien day 2 pixel the hien trang thai (dung vi tri, goi y...)
+    SDL_SetRenderDrawColor(renderer, mColour.r, mColour.g, mColour.b, 255);
+    SDL_Rect border = mRect;
+    SDL_RenderDrawRect(renderer, &border);
+    border = {mRect.x + 1, mRect.y + 1, mRect.w - 2, mRect.h - 2};
+    SDL_RenderDrawRect(renderer, &border);
+
+    if (numbers != nullptr) {
+        char numberStr[12];
+        snprintf(numberStr, sizeof(numberStr), "%d", mNumber);
+        numbers->renderCentered(renderer, numberStr, mRect, mFontColour);
+    }
 }
\ No newline at end of file
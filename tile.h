@@ -2,10 +2,13 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 #include "button.h"
+#include "glyphAtlas.h"
 
 class Tile: public Button {
     private:
         int mNumber;
+        // Vung cua tile trong anh o che do xep hinh
+        SDL_Rect mPictureRect;
         
     public:
         Tile(const SDL_Rect& rect, const SDL_Color& colour, TTF_Font* const font, const SDL_Color& mFontColour, const int number);
@@ -13,7 +16,11 @@ class Tile: public Button {
         int getXPosition();
         int getYPosition();
         void setPositionTo(const int x, const int y);
-        bool moveTo(const int x, const int y);
-        int getNumber();
+        int getNumber() const;
+
+        // Che do xep hinh: ve vung cua minh trong anh chung, vien theo mau tile
+        // va so (neu numbers khac nullptr) lay tu glyph atlas, khong can texture rieng
+        void setPictureRect(const SDL_Rect& rect);
+        void renderPicture(SDL_Renderer* const renderer, SDL_Texture* const picture, const GlyphAtlas* const numbers) const;
         
 };
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include "timing.h"
+
+FixedTimestep::FixedTimestep(const uint64_t frequency, const unsigned int updatesPerSecond)
+    : mStepTicks(frequency / updatesPerSecond), mLast(0), mAccumulator(0), mSteps(0),
+      mUpdatesPerSecond(updatesPerSecond) {
+    if (mStepTicks == 0)
+        mStepTicks = 1;
+}
+
+void FixedTimestep::start(const uint64_t now) {
+    mLast = now;
+    mAccumulator = 0;
+}
+
+int FixedTimestep::advance(const uint64_t now) {
+    mAccumulator += now - mLast;
+    mLast = now;
+
+    int updates = (int)(mAccumulator / mStepTicks);
+    if (updates > MAX_UPDATES_PER_FRAME) {
+        updates = MAX_UPDATES_PER_FRAME;
+        mAccumulator = updates * mStepTicks + mAccumulator % mStepTicks;
+    }
+    return updates;
+}
+
+void FixedTimestep::step() {
+    mAccumulator -= mStepTicks;
+    mSteps++;
+}
+
+uint32_t FixedTimestep::getTime() const {
+    // Tinh tu so buoc chu khong cong don de khong bi sai so
+    return (uint32_t)(mSteps * 1000 / mUpdatesPerSecond);
+}
+
+double FixedTimestep::getAlpha() const {
+    return (double)mAccumulator / mStepTicks;
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <stdint.h>
+
+// So lan cap nhat mo phong moi giay, khong phu thuoc vao toc do ve
+const unsigned int UPDATES_PER_SECOND = 120;
+// Toi da so lan cap nhat trong mot frame, frame qua cham thi bo bot thoi gian thay vi duoi theo mai
+const int MAX_UPDATES_PER_FRAME = 8;
+
+// Cau hinh toc do ve: vsync va gioi han FPS (0 = khong gioi han)
+struct FrameConfig {
+    bool vsync;
+    unsigned int fps;
+    // Khong vsync, khong gioi han, in FPS trung binh khi thoat (do hieu nang)
+    bool uncapped;
+};
+
+class FixedTimestep {
+    // Vong lap buoc co dinh: thoi gian thuc (don vi cua bo dem hieu nang) duoc cong don,
+    // du mot buoc thi mo phong mot lan, phan du dung de noi suy khi ve
+    // Khong goi SDL, gia tri bo dem duoc truyen vao tu ngoai
+    private:
+        uint64_t mStepTicks;
+        uint64_t mLast;
+        uint64_t mAccumulator;
+        uint64_t mSteps;
+        unsigned int mUpdatesPerSecond;
+
+    public:
+        FixedTimestep(const uint64_t frequency, const unsigned int updatesPerSecond);
+
+        void start(const uint64_t now);
+        // Cong thoi gian tu lan goi truoc, tra ve so lan can cap nhat trong frame nay
+        int advance(const uint64_t now);
+        // Danh dau da xong mot lan cap nhat
+        void step();
+        // Thoi gian mo phong (ms) sau cac buoc da chay
+        uint32_t getTime() const;
+        // Phan cua buoc tiep theo da troi qua, trong [0, 1)
+        double getAlpha() const;
+};
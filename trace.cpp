@@ -0,0 +1,97 @@
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <mutex>
+#include <memory>
+#include <vector>
+#include "trace.h"
+
+using namespace std;
+
+// Moc thoi gian cua file vet
+static const chrono::steady_clock::time_point TRACE_START = chrono::steady_clock::now();
+
+struct TraceEvent {
+    const char* name;
+    uint64_t start;
+    uint64_t duration;
+};
+
+struct TraceBuffer {
+    // Chi luong so huu ghi vao, doc khi cac luong da dung nen khong can khoa
+    int id;
+    const char* name;
+    vector<TraceEvent> events;
+    size_t written;
+};
+
+static atomic<bool> tracing(false);
+static mutex buffersMutex;
+static vector<unique_ptr<TraceBuffer>> buffers;
+static thread_local TraceBuffer* threadBuffer = nullptr;
+
+static TraceBuffer* getThreadBuffer() {
+    // Moi luong dang ky bo dem cua minh mot lan, bo dem song den khi ghi file
+    if (threadBuffer == nullptr) {
+        lock_guard<mutex> lock(buffersMutex);
+        buffers.emplace_back(new TraceBuffer{(int)buffers.size() + 1, nullptr, vector<TraceEvent>(TRACE_EVENTS_PER_THREAD), 0});
+        threadBuffer = buffers.back().get();
+    }
+    return threadBuffer;
+}
+
+void startTracing() {
+    tracing = true;
+}
+
+bool isTracing() {
+    return tracing.load(memory_order_relaxed);
+}
+
+uint64_t traceNow() {
+    // Cong 1 de TraceScope dung start = 0 lam dau hieu khong ghi vet
+    return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - TRACE_START).count() + 1;
+}
+
+void traceThreadName(const char* name) {
+    if (isTracing())
+        getThreadBuffer()->name = name;
+}
+
+void traceSpan(const char* name, const uint64_t start, const uint64_t duration) {
+    TraceBuffer* buffer = getThreadBuffer();
+    buffer->events[buffer->written % TRACE_EVENTS_PER_THREAD] = {name, start, duration};
+    buffer->written++;
+}
+
+bool writeTrace(const string& path) {
+    ofstream output(path);
+    if (!output) {
+        cout << "Unable to write " << path << endl;
+        return false;
+    }
+
+    lock_guard<mutex> lock(buffersMutex);
+    size_t total = 0;
+    bool first = true;
+    output << "{\"traceEvents\":[";
+    for (const auto& buffer : buffers) {
+        if (buffer->name != nullptr) {
+            output << (first ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->id
+                   << ",\"args\":{\"name\":\"" << buffer->name << "\"}}";
+            first = false;
+        }
+        // Bo dem da vong thi su kien cu nhat nam ngay sau vi tri ghi tiep theo
+        const size_t count = min(buffer->written, TRACE_EVENTS_PER_THREAD);
+        for (size_t i = buffer->written - count; i < buffer->written; i++) {
+            const TraceEvent& event = buffer->events[i % TRACE_EVENTS_PER_THREAD];
+            output << (first ? "\n" : ",\n") << "{\"name\":\"" << event.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":"
+                   << buffer->id << ",\"ts\":" << event.start << ",\"dur\":" << event.duration << "}";
+            first = false;
+        }
+        total += count;
+    }
+    output << "\n]}\n";
+    cout << "Wrote " << total << " trace events to " << path << endl;
+    return true;
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <stdint.h>
+#include <atomic>
+#include <string>
+
+// So su kien toi da giu lai cho moi luong, day thi ghi de su kien cu nhat
+const size_t TRACE_EVENTS_PER_THREAD = 1 << 16;
+
+// Bat ghi vet (--trace), phai goi truoc khi cac luong khac bat dau
+void startTracing();
+bool isTracing();
+// Dat ten cho luong hien tai trong trinh xem vet
+void traceThreadName(const char* name);
+// Ghi mot doan [start, start + duration] (micro giay) vao bo dem vong cua luong hien tai
+void traceSpan(const char* name, const uint64_t start, const uint64_t duration);
+uint64_t traceNow();
+// Ghi moi su kien da giu lai ra file JSON theo dinh dang trace event cua Chrome/Perfetto,
+// chi goi khi cac luong khac da dung
+bool writeTrace(const std::string& path);
+
+class TraceScope {
+    // Do mot doan tu luc tao den luc huy, khong lam gi khi khong bat ghi vet
+    // name phai song den khi ghi file (chuoi hang)
+    private:
+        const char* mName;
+        uint64_t mStart;
+
+    public:
+        TraceScope(const char* name)
+            : mName(name), mStart(isTracing() ? traceNow() : 0) {
+        }
+
+        ~TraceScope() {
+            if (mStart != 0)
+                traceSpan(mName, mStart, traceNow() - mStart);
+        }
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(traceScope, __LINE__)(name)
@@ -0,0 +1,44 @@
+#pragma once
+#include <atomic>
+
+template <typename T>
+class TripleBuffer {
+    // Bo dem ba khong khoa cho mot luong ghi va mot luong doc
+    // Luong ghi viet vao back() roi publish() doi no voi o giua, luong doc fetch() doi o giua lay ban moi nhat
+    // Khong ben nao phai cho ben kia; ban chua kip doc bi ban moi hon thay the
+    private:
+        static const int INDEX_MASK = 3;
+        // O giua chua ban moi ma luong doc chua lay
+        static const int FRESH = 4;
+
+        T mBuffers[3];
+        std::atomic<int> mMiddle;
+        int mBack;
+        int mFront;
+
+    public:
+        TripleBuffer()
+            : mBuffers(), mMiddle(1), mBack(0), mFront(2) {
+        }
+
+        // Chi luong ghi
+        T& back() {
+            return mBuffers[mBack];
+        }
+
+        void publish() {
+            mBack = mMiddle.exchange(mBack | FRESH, std::memory_order_acq_rel) & INDEX_MASK;
+        }
+
+        // Chi luong doc: true khi co ban moi, front() khong doi cho den lan fetch() tiep theo
+        bool fetch() {
+            if ((mMiddle.load(std::memory_order_relaxed) & FRESH) == 0)
+                return false;
+            mFront = mMiddle.exchange(mFront, std::memory_order_acq_rel) & INDEX_MASK;
+            return true;
+        }
+
+        const T& front() const {
+            return mBuffers[mFront];
+        }
+};
@@ -1,4 +1,7 @@
+#include <stdio.h>
 #include "userInterface.h"
+#include "resources.h"
+#include "trace.h"
 
 using namespace std;
 
@@ -9,17 +12,38 @@ UserInterface::UserInterface(const SDL_Rect& rect, const SDL_Color& colour, TTF_
     mFontRect = {0, 0, 0, 0};
     mFontColour = fontColour;
     mFont = font;
-    mTexture = nullptr;
+    mAtlas = nullptr;
+    mText[0] = '\0';
+}
+
+void UserInterface::setGlyphAtlas(const GlyphAtlas* const atlas) {
+    mAtlas = atlas;
+}
+
+void UserInterface::setText(const char* text) {
+    // loadTexture(renderer, getText()) chi ve lai van ban hien tai
+    if (text != mText)
+        snprintf(mText, sizeof(mText), "%s", text);
 }
 
 void UserInterface::loadTexture(SDL_Renderer* const renderer, const char* text) {
+    TRACE_SCOPE("loadTexture");
     free(); 
+    setText(text);
+
+    if (mAtlas != nullptr) {
+        // Chi nho van ban va kich thuoc, chu duoc ve tu atlas luc render
+        mFontRect.w = mAtlas->measure(mText);
+        mFontRect.h = mAtlas->getHeight();
+        centerText();
+        return;
+    }
 
     SDL_Surface* textSurface = TTF_RenderText_Solid(mFont, text, mFontColour);
     if (textSurface == nullptr)
         cout << "Unable to render text surface! Error: " << TTF_GetError() << endl; // Khi TTF_RenderText_Solid loi thi tra ve nullptr
     else {
-        mTexture = SDL_CreateTextureFromSurface(renderer, textSurface);
+        mTexture.reset(TRACK_TEXTURE(SDL_CreateTextureFromSurface(renderer, textSurface)));
         if (mTexture == nullptr)
             cout << "Unable to create texture form rendered text! Error: " << SDL_GetError() << endl;
         else 
@@ -43,15 +67,30 @@ void UserInterface::render(SDL_Renderer* const renderer) const {
     SDL_SetRenderDrawColor(renderer, mColour.r, mColour.g, mColour.b, mColour.a);
     SDL_RenderFillRect(renderer, &mRect);
 
-    if (mTexture != nullptr)
-        SDL_RenderCopy(renderer, mTexture, nullptr, &mFontRect);
+    if (mAtlas != nullptr)
+        mAtlas->render(renderer, mText, mFontRect.x, mFontRect.y, mFontColour);
+    else if (mTexture != nullptr)
+        SDL_RenderCopy(renderer, mTexture.get(), nullptr, &mFontRect);
     else
         cout << "Warning: no texture to render!" << endl;
 }
 
 void UserInterface::free() {
-    if (mTexture != nullptr) {
-        SDL_DestroyTexture(mTexture);
-        mTexture = nullptr;
-    }
+    mTexture.reset();
+}
+
+const SDL_Rect& UserInterface::getRect() const {
+    return mRect;
+}
+
+const SDL_Color& UserInterface::getColour() const {
+    return mColour;
+}
+
+const SDL_Color& UserInterface::getFontColour() const {
+    return mFontColour;
+}
+
+const char* UserInterface::getText() const {
+    return mText;
 }
@@ -2,8 +2,12 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 #include <iostream>
+#include "glyphAtlas.h"
+#include "resources.h"
 
 class UserInterface {
+    // Chi di chuyen duoc, khong sao chep: texture cua chu thuoc ve dung mot doi tuong
+    // va duoc huy cung doi tuong do (hoac khi free/loadTexture lai)
     protected:
         SDL_Rect mRect;
         SDL_Color mColour;
@@ -12,7 +16,10 @@ class UserInterface {
         TTF_Font* mFont;
         SDL_Rect mFontRect;
         SDL_Color mFontColour;
-        SDL_Texture* mTexture;
+        TextureHandle mTexture;
+        // Co atlas (font ve san) thi chu duoc ve tu atlas, khong tao texture rieng
+        const GlyphAtlas* mAtlas;
+        char mText[32];
 
         void centerText();
         void leftText();
@@ -20,10 +27,22 @@ class UserInterface {
     public:
         //Ham nhap gia tri
         UserInterface(const SDL_Rect& rect, const SDL_Color& colour, TTF_Font* const font, const SDL_Color& fontColour);
+        UserInterface(UserInterface&& other) = default;
+        UserInterface& operator=(UserInterface&& other) = default;
+        UserInterface(const UserInterface&) = delete;
+        UserInterface& operator=(const UserInterface&) = delete;
 
         //Ham load cau truc van ban
+        void setGlyphAtlas(const GlyphAtlas* const atlas);
+        // Chi doi van ban, khong tao texture (dung cho doi tuong cua luong mo phong)
+        void setText(const char* text);
         void loadTexture(SDL_Renderer* const renderer, const char* text);
         void render(SDL_Renderer* const renderer) const;
         void free();
 
+        const SDL_Rect& getRect() const;
+        const SDL_Color& getColour() const;
+        const SDL_Color& getFontColour() const;
+        const char* getText() const;
+
 };